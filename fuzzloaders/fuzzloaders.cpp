@@ -27,14 +27,18 @@
 
 #include <Windows.h>
 #include <dxgiformat.h>
+#include <psapi.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cstdio>
+#include <cstring>
 #include <cwchar>
 #include <memory>
 #include <new>
 #include <list>
 #include <tuple>
+#include <string>
 #include <utility>
 
 #include "DirectXMesh.h"
@@ -64,6 +68,11 @@ namespace
         OPT_WAVEFRONT_OBJ,
         OPT_WAVEFRONT_MTL,
         OPT_VBO,
+        OPT_STATS,
+        OPT_TIME_BUDGET,
+        OPT_MEMORY_BUDGET,
+        OPT_SLOW_CORPUS,
+        OPT_VBO_CROSS_CHECK,
         OPT_MAX
     };
 
@@ -79,6 +88,11 @@ namespace
         { L"wfo",       OPT_WAVEFRONT_OBJ },
         { L"mtl",       OPT_WAVEFRONT_MTL },
         { L"vbo",       OPT_VBO },
+        { L"stats",     OPT_STATS },
+        { L"time",      OPT_TIME_BUDGET },
+        { L"mem",       OPT_MEMORY_BUDGET },
+        { L"slow",      OPT_SLOW_CORPUS },
+        { L"vbocheck",  OPT_VBO_CROSS_CHECK },
         { nullptr,      0 }
     };
 
@@ -96,11 +110,132 @@ namespace
             L"   -r                  wildcard filename search is recursive\n"
             L"   -wfo                force use of WaveFront OBJ loader\n"
             L"   -mtl                force use of WaveFront MTL loader\n"
-            L"   -vbo                force use of VBO loader\n";
+            L"   -vbo                force use of VBO loader\n"
+            L"   -stats              report per-file parse time, throughput, and peak memory\n"
+            L"   -time <ms>          flag loads slower than <ms> milliseconds as performance regressions\n"
+            L"   -mem <MB>           flag files that raise peak memory above <MB> megabytes\n"
+            L"   -slow <dir>         copy flagged inputs into <dir> as a slow-input corpus\n"
+            L"   -vbocheck           cross-check accepted VBO files against WaveFrontReader::LoadVBO\n";
 
         wprintf(L"%ls", s_usage);
     }
 
+    //////////////////////////////////////////////////////////////////////////////
+    //////////////////////////////////////////////////////////////////////////////
+    //////////////////////////////////////////////////////////////////////////////
+
+    // Runs a loader and returns its result, with the elapsed wall-clock time in milliseconds
+    template<typename TLoader>
+    HRESULT TimedLoad(TLoader&& loader, double& elapsedMS)
+    {
+        static LARGE_INTEGER s_frequency = {};
+        if (!s_frequency.QuadPart)
+        {
+            std::ignore = QueryPerformanceFrequency(&s_frequency);
+        }
+
+        LARGE_INTEGER start = {};
+        std::ignore = QueryPerformanceCounter(&start);
+
+        const HRESULT hr = loader();
+
+        LARGE_INTEGER end = {};
+        std::ignore = QueryPerformanceCounter(&end);
+
+        elapsedMS = double(end.QuadPart - start.QuadPart) * 1000.0 / double(s_frequency.QuadPart);
+        return hr;
+    }
+
+    // High-water mark of committed private memory for the process
+    size_t GetPeakMemory() noexcept
+    {
+        PROCESS_MEMORY_COUNTERS counters = {};
+        counters.cb = sizeof(counters);
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+            return 0;
+
+        return counters.PeakPagefileUsage;
+    }
+
+    double GetThroughputMBs(uint64_t bytes, double ms) noexcept
+    {
+        return (ms > 0) ? (double(bytes) / (1024.0 * 1024.0)) / (ms / 1000.0) : 0.0;
+    }
+
+    uint64_t GetInputFileSize(const wchar_t* szFile) noexcept
+    {
+        WIN32_FILE_ATTRIBUTE_DATA data = {};
+        if (!GetFileAttributesExW(szFile, GetFileExInfoStandard, &data))
+            return 0;
+
+        return (uint64_t(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+    }
+
+    // Both VBO loaders must agree on every vertex and index of a file they accept.
+    // Returns S_OK if the contents match, S_FALSE if they differ, or the reference loader's failure code.
+    HRESULT CompareWithWaveFrontVBO(const wchar_t* szFile, const Mesh& mesh)
+    {
+        DX::WaveFrontReader<uint16_t> wfr;
+        HRESULT hr = wfr.LoadVBO(szFile);
+        if (FAILED(hr))
+            return hr;
+
+        const size_t nVerts = mesh.GetVertexCount();
+        if (wfr.vertices.size() != nVerts
+            || wfr.indices.size() != mesh.GetFaceCount() * 3)
+            return S_FALSE;
+
+        const DirectX::XMFLOAT3* positions = mesh.GetPositionBuffer();
+        const DirectX::XMFLOAT3* normals = mesh.GetNormalBuffer();
+        const DirectX::XMFLOAT2* texcoords = mesh.GetTexCoordBuffer();
+        const uint32_t* indices = mesh.GetIndexBuffer();
+        if (!positions || !normals || !texcoords || !indices)
+            return S_FALSE;
+
+        for (size_t j = 0; j < nVerts; ++j)
+        {
+            const auto& v = wfr.vertices[j];
+            if (memcmp(&positions[j], &v.position, sizeof(DirectX::XMFLOAT3)) != 0
+                || memcmp(&normals[j], &v.normal, sizeof(DirectX::XMFLOAT3)) != 0
+                || memcmp(&texcoords[j], &v.textureCoordinate, sizeof(DirectX::XMFLOAT2)) != 0)
+                return S_FALSE;
+        }
+
+        // Mesh widens the 16-bit strip-cut value to its 32-bit equivalent
+        for (size_t j = 0; j < wfr.indices.size(); ++j)
+        {
+            const uint16_t i = wfr.indices[j];
+            if (indices[j] != ((i == uint16_t(-1)) ? uint32_t(-1) : uint32_t(i)))
+                return S_FALSE;
+        }
+
+        return S_OK;
+    }
+
+    // Copies an input that exceeded a budget into the slow-input corpus directory.
+    // The index keeps same-named files from different source directories apart.
+    void SaveSlowInput(const std::wstring& slowDir, const wchar_t* szFile, size_t index)
+    {
+        wchar_t fname[_MAX_FNAME] = {};
+        wchar_t ext[_MAX_EXT] = {};
+        _wsplitpath_s(szFile, nullptr, 0, nullptr, 0, fname, _MAX_FNAME, ext, _MAX_EXT);
+
+        std::wstring dest = slowDir;
+        if (!dest.empty() && dest.back() != L'\\' && dest.back() != L'/')
+        {
+            dest += L'\\';
+        }
+        dest += fname;
+        dest += L'_';
+        dest += std::to_wstring(index);
+        dest += ext;
+
+        if (!CopyFileW(szFile, dest.c_str(), FALSE))
+        {
+            wprintf(L"\nWARNING: Failed to copy slow input to %ls (%08X)\n", dest.c_str(), static_cast<unsigned int>(HRESULT_FROM_WIN32(GetLastError())));
+        }
+    }
+
 #endif // !FUZZING_BUILD_MODE
 }
 
@@ -117,6 +252,9 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
 {
     // Process command line
     uint32_t dwOptions = 0;
+    uint32_t timeBudgetMS = 0;
+    uint32_t memoryBudgetMB = 0;
+    std::wstring slowDir;
     std::list<SConversion> conversion;
 
     for (int iArg = 1; iArg < argc; iArg++)
@@ -143,6 +281,29 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
 
             dwOptions |= 1 << dwOption;
 
+            // Handle options with additional value parameter
+            switch (dwOption)
+            {
+            case OPT_TIME_BUDGET:
+            case OPT_MEMORY_BUDGET:
+            case OPT_SLOW_CORPUS:
+                if (!*pValue)
+                {
+                    if ((iArg + 1 >= argc))
+                    {
+                        PrintUsage();
+                        return 1;
+                    }
+
+                    iArg++;
+                    pValue = argv[iArg];
+                }
+                break;
+
+            default:
+                break;
+            }
+
             switch (dwOption)
             {
             case OPT_WAVEFRONT_OBJ:
@@ -161,6 +322,33 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
                 }
                 break;
 
+            case OPT_TIME_BUDGET:
+                if (swscanf_s(pValue, L"%u", &timeBudgetMS) != 1 || !timeBudgetMS)
+                {
+                    wprintf(L"Invalid value specified with -time (%ls)\n\n", pValue);
+                    PrintUsage();
+                    return 1;
+                }
+                break;
+
+            case OPT_MEMORY_BUDGET:
+                if (swscanf_s(pValue, L"%u", &memoryBudgetMB) != 1 || !memoryBudgetMB)
+                {
+                    wprintf(L"Invalid value specified with -mem (%ls)\n\n", pValue);
+                    PrintUsage();
+                    return 1;
+                }
+                break;
+
+            case OPT_SLOW_CORPUS:
+                slowDir = pValue;
+                if (!CreateDirectoryW(slowDir.c_str(), nullptr) && GetLastError() != ERROR_ALREADY_EXISTS)
+                {
+                    wprintf(L"ERROR: Failed to create slow-input directory %ls\n", slowDir.c_str());
+                    return 1;
+                }
+                break;
+
             default:
                 break;
             }
@@ -191,8 +379,24 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
         return 0;
     }
 
+    const bool stats = (dwOptions & (1 << OPT_STATS)) != 0;
+    const bool vboCheck = (dwOptions & (1 << OPT_VBO_CROSS_CHECK)) != 0;
+    const size_t memoryBudget = size_t(memoryBudgetMB) * 1024 * 1024;
+
+    size_t nSlow = 0;
+    double totalMS = 0;
+    uint64_t totalBytes = 0;
+    double worstMS = 0;
+    std::wstring worstFile;
+
     for (auto& pConv : conversion)
     {
+        const size_t peakBefore = GetPeakMemory();
+        const uint64_t fileSize = GetInputFileSize(pConv.szSrc.c_str());
+        double wfoMS = 0;
+        double mtlMS = 0;
+        double vboMS = 0;
+
         wchar_t ext[_MAX_EXT] = {};
         _wsplitpath_s(pConv.szSrc.c_str(), nullptr, 0, nullptr, 0, nullptr, 0, ext, _MAX_EXT);
         const bool iswfo = (_wcsicmp(ext, L"._obj") == 0) || (_wcsicmp(ext, L".obj") == 0);
@@ -232,7 +436,7 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
             DX::WaveFrontReader<uint32_t> wfr;
 
             // Loads ignoring any MTL file reference.
-            HRESULT hr = wfr.Load(pConv.szSrc.c_str(), true, false);
+            HRESULT hr = TimedLoad([&]() { return wfr.Load(pConv.szSrc.c_str(), true, false); }, wfoMS);
             if (hr == HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND))
             {
                 wprintf(L"ERROR: WaveFront OBJ file not not found:\n%ls\n", pConv.szSrc.c_str());
@@ -263,7 +467,7 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
         {
             DX::WaveFrontReader<uint32_t> wfr;
 
-            HRESULT hr = wfr.LoadMTL(pConv.szSrc.c_str());
+            HRESULT hr = TimedLoad([&]() { return wfr.LoadMTL(pConv.szSrc.c_str()); }, mtlMS);
             if (hr == HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND))
             {
                 wprintf(L"ERROR: WaveFront MTL file not not found:\n%ls\n", pConv.szSrc.c_str());
@@ -290,10 +494,11 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
             }
         }
 
+        std::unique_ptr<Mesh> vboMesh;
+        bool verifyVBO = false;
         if (usevbo)
         {
-            std::unique_ptr<Mesh> inMesh;
-            HRESULT hr = Mesh::CreateFromVBO(pConv.szSrc.c_str(), inMesh);
+            HRESULT hr = TimedLoad([&]() { return Mesh::CreateFromVBO(pConv.szSrc.c_str(), vboMesh); }, vboMS);
             if (hr == HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND))
             {
                 wprintf(L"ERROR: VBO file not not found:\n%ls\n", pConv.szSrc.c_str());
@@ -317,12 +522,96 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
             }
             else
             {
+                verifyVBO = vboCheck && SUCCEEDED(hr) && vboMesh;
                 wprintf(L"%ls", SUCCEEDED(hr) ? L"*" : L".");
             }
         }
+
+        // Performance telemetry
+        const double fileMS = wfoMS + mtlMS + vboMS;
+        const size_t peakAfter = GetPeakMemory();
+
+        // Cross-check after sampling the peak so its second load isn't charged to the input
+        if (verifyVBO)
+        {
+            HRESULT hr = CompareWithWaveFrontVBO(pConv.szSrc.c_str(), *vboMesh);
+            if (FAILED(hr))
+            {
+                // Stricter validation in the reference loader is not a data mismatch
+                wprintf(L"\nWARNING: WaveFrontReader::LoadVBO rejected %ls (%08X)\n", pConv.szSrc.c_str(), static_cast<unsigned int>(hr));
+            }
+            else if (hr == S_FALSE)
+            {
+#ifdef _DEBUG
+                OutputDebugStringA("VBO load differs from WaveFrontReader::LoadVBO\n");
+#endif
+                wprintf(L"!");
+            }
+        }
+        vboMesh.reset();
+
+        totalMS += fileMS;
+        totalBytes += fileSize;
+        if (fileMS > worstMS)
+        {
+            worstMS = fileMS;
+            worstFile = pConv.szSrc;
+        }
+
+        if (stats)
+        {
+            wprintf(L"\n%ls: %llu bytes, wfo %.3f ms (%.2f MB/s), mtl %.3f ms (%.2f MB/s), vbo %.3f ms (%.2f MB/s), peak %zu KB\n",
+                pConv.szSrc.c_str(),
+                fileSize,
+                wfoMS, GetThroughputMBs(fileSize, wfoMS),
+                mtlMS, GetThroughputMBs(fileSize, mtlMS),
+                vboMS, GetThroughputMBs(fileSize, vboMS),
+                peakAfter / 1024);
+        }
+
+        bool slow = false;
+        if (timeBudgetMS > 0 && std::max(wfoMS, std::max(mtlMS, vboMS)) > double(timeBudgetMS))
+        {
+            wprintf(L"\nPERF: %ls exceeded time budget of %u ms (wfo %.3f ms, mtl %.3f ms, vbo %.3f ms)\n",
+                pConv.szSrc.c_str(), timeBudgetMS, wfoMS, mtlMS, vboMS);
+            slow = true;
+        }
+
+        // Peak is a process high-water mark, so only the input that raises it over budget is flagged
+        if (memoryBudget > 0 && peakAfter > memoryBudget && peakBefore <= memoryBudget)
+        {
+            wprintf(L"\nPERF: %ls exceeded memory budget of %u MB (peak %zu KB)\n",
+                pConv.szSrc.c_str(), memoryBudgetMB, peakAfter / 1024);
+            slow = true;
+        }
+
+        if (slow)
+        {
+            if (!slowDir.empty())
+            {
+                SaveSlowInput(slowDir, pConv.szSrc.c_str(), nSlow);
+            }
+            ++nSlow;
+        }
+
         fflush(stdout);
     }
 
+    if (stats || timeBudgetMS > 0 || memoryBudgetMB > 0)
+    {
+        wprintf(L"\n%zu files, %llu bytes, %.3f ms total, peak %zu KB, %zu over budget\n",
+            conversion.size(),
+            totalBytes,
+            totalMS,
+            GetPeakMemory() / 1024,
+            nSlow);
+
+        if (!worstFile.empty())
+        {
+            wprintf(L"Slowest: %ls (%.3f ms)\n", worstFile.c_str(), worstMS);
+        }
+    }
+
     wprintf(L"\n*** FUZZING COMPLETE ***\n");
 
     return 0;
@@ -332,31 +621,68 @@ int __cdecl wmain(_In_ int argc, _In_z_count_(argc) wchar_t* argv[])
 #else // FUZZING_BUILD_MODE
 
 
+namespace
+{
+    // A single temporary file is rewritten for every input and removed at exit,
+    // rather than creating (and leaking) a new uniquely named file per input.
+    class FuzzTempFile
+    {
+    public:
+        FuzzTempFile() noexcept : m_path{}
+        {
+            wchar_t tempPath[MAX_PATH] = {};
+            if (!GetTempPathW(MAX_PATH, tempPath)
+                || !GetTempFileNameW(tempPath, L"fuzz", 0, m_path))
+            {
+                m_path[0] = 0;
+            }
+        }
+
+        ~FuzzTempFile()
+        {
+            if (*m_path)
+            {
+                std::ignore = DeleteFileW(m_path);
+            }
+        }
+
+        FuzzTempFile(FuzzTempFile const&) = delete;
+        FuzzTempFile& operator=(FuzzTempFile const&) = delete;
+
+        bool Write(const uint8_t* data, size_t size) noexcept
+        {
+            if (!*m_path)
+                return false;
+
+            // Temporary attribute lets the OS keep the contents in cache instead of flushing to disk
+            ScopedHandle hFile(safe_handle(CreateFileW(m_path, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                FILE_ATTRIBUTE_TEMPORARY, nullptr)));
+            if (!hFile)
+                return false;
+
+            DWORD bytesWritten = 0;
+            return WriteFile(hFile.get(), data, static_cast<DWORD>(size), &bytesWritten, nullptr) != 0;
+        }
+
+        const wchar_t* c_str() const noexcept { return m_path; }
+
+    private:
+        wchar_t m_path[MAX_PATH];
+    };
+}
+
+
 //--------------------------------------------------------------------------------------
 // Libfuzzer entry-point
 //--------------------------------------------------------------------------------------
 extern "C" __declspec(dllexport) int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
 {
     // Disk version
-    wchar_t tempFileName[MAX_PATH] = {};
-    wchar_t tempPath[MAX_PATH] = {};
-
-    if (!GetTempPathW(MAX_PATH, tempPath))
-        return 0;
-
-    if (!GetTempFileNameW(tempPath, L"fuzz", 0, tempFileName))
+    static FuzzTempFile s_tempFile;
+    if (!s_tempFile.Write(data, size))
         return 0;
 
-    {
-        ScopedHandle hFile(safe_handle(CreateFileW(tempFileName, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
-                FILE_ATTRIBUTE_NORMAL, nullptr)));
-        if (!hFile)
-            return 0;
-
-        DWORD bytesWritten = 0;
-        if (!WriteFile(hFile.get(), data, static_cast<DWORD>(size), &bytesWritten, nullptr))
-            return 0;
-    }
+    const wchar_t* tempFileName = s_tempFile.c_str();
 
     {
         DX::WaveFrontReader<uint32_t> wfr;
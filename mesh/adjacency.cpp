@@ -2829,6 +2829,113 @@ bool Test23()
         }
     }
 
+    // Large (32)
+    {
+        // Face count chosen to exceed any serial threshold and to not be a multiple of a chunk size
+        constexpr size_t nFaces = 1048573;
+
+        auto srcib = CreateIndexBuffer<uint32_t>(nFaces * 3, IB_IDENTITY);
+
+        std::unique_ptr<uint32_t[]> srcadj(new uint32_t[nFaces * 3]);
+        for (size_t j = 0; j < nFaces; ++j)
+        {
+            srcadj[j * 3] = uint32_t((j + 1) % nFaces);
+            srcadj[j * 3 + 1] = uint32_t((j + nFaces - 1) % nFaces);
+            srcadj[j * 3 + 2] = (j & 1) ? uint32_t(-1) : uint32_t((j + nFaces / 2) % nFaces);
+        }
+
+        std::unique_ptr<uint32_t[]> remap(new uint32_t[nFaces]);
+        for (uint32_t j = 0; j < nFaces; ++j)
+            remap[j] = j;
+
+        // Fixed-seed LCG shuffle so any failure is reproducible
+        constexpr uint32_t c_seed = 0x2545F491u;
+        uint32_t seed = c_seed;
+        for (uint32_t j = uint32_t(nFaces - 1); j > 0; --j)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            std::swap(remap[j], remap[seed % (j + 1)]);
+        }
+
+        // Unused faces are skipped rather than written, so prefill the destination
+        const uint32_t unusedFace = remap[nFaces / 2];
+        remap[nFaces / 2] = uint32_t(-1);
+
+        std::unique_ptr<uint32_t[]> destib(new uint32_t[nFaces * 3]);
+        memset(destib.get(), 0xff, sizeof(uint32_t) * nFaces * 3);
+
+        std::unique_ptr<uint32_t[]> adj(new uint32_t[nFaces * 3]);
+        memset(adj.get(), 0xff, sizeof(uint32_t) * nFaces * 3);
+
+        HRESULT hr = ReorderIBAndAdjacency(srcib.get(), nFaces, srcadj.get(), remap.get(), destib.get(), adj.get());
+        if (FAILED(hr))
+        {
+            printe("ERROR: ReorderIBAndAdjacency(32) large failed (%08X, seed %08X)\n", static_cast<unsigned int>(hr), c_seed);
+            success = false;
+        }
+        else
+        {
+            for (size_t j = 0; j < nFaces; ++j)
+            {
+                uint32_t f = remap[j];
+
+                bool matches = true;
+                for (size_t k = 0; k < 3; ++k)
+                {
+                    if (f == uint32_t(-1))
+                    {
+                        if (destib[j * 3 + k] != uint32_t(-1) || adj[j * 3 + k] != uint32_t(-1))
+                            matches = false;
+                    }
+                    else if (destib[j * 3 + k] != (f * 3 + k) || adj[j * 3 + k] != srcadj[f * 3 + k])
+                    {
+                        matches = false;
+                    }
+                }
+
+                if (!matches)
+                {
+                    printe("ERROR: ReorderIBAndAdjacency(32) large failed at face %zu (seed %08X)\n", j, c_seed);
+                    success = false;
+                    break;
+                }
+            }
+        }
+
+        // In-place swapping requires a complete permutation
+        remap[nFaces / 2] = unusedFace;
+
+        memcpy(adj.get(), srcadj.get(), sizeof(uint32_t) * nFaces * 3);
+
+        hr = ReorderIBAndAdjacency(srcib.get(), nFaces, adj.get(), remap.get());
+        if (FAILED(hr))
+        {
+            printe("ERROR: ReorderIBAndAdjacency(32) large [in-place] failed (%08X, seed %08X)\n", static_cast<unsigned int>(hr), c_seed);
+            success = false;
+        }
+        else
+        {
+            for (size_t j = 0; j < nFaces; ++j)
+            {
+                uint32_t f = remap[j];
+
+                bool matches = true;
+                for (size_t k = 0; k < 3; ++k)
+                {
+                    if (srcib[j * 3 + k] != (f * 3 + k) || adj[j * 3 + k] != srcadj[f * 3 + k])
+                        matches = false;
+                }
+
+                if (!matches)
+                {
+                    printe("ERROR: ReorderIBAndAdjacency(32) large [in-place] failed at face %zu (seed %08X)\n", j, c_seed);
+                    success = false;
+                    break;
+                }
+            }
+        }
+    }
+
     return success;
 }
 
@@ -13,6 +13,9 @@
 #include "TestHelpers.h"
 #include "TestGeometry.h"
 
+#include <algorithm>
+#include <tuple>
+
 using namespace DirectX;
 using namespace TestGeometry;
 
@@ -36,6 +39,133 @@ namespace
     };
 
     const float g_Epsilon = 0.0001f;
+
+    // Verifies every source face appears in exactly one meshlet with its winding preserved
+    template<typename index_t>
+    bool IsValidMeshletCover(
+        _In_reads_(nFaces * 3) const index_t* indices, size_t nFaces, size_t nVerts,
+        const std::vector<Meshlet>& meshlets,
+        const std::vector<uint8_t>& uniqueVertexIB,
+        const std::vector<MeshletTriangle>& primitiveIndices,
+        size_t maxVerts, size_t maxPrims)
+    {
+        auto uniqueVertexIndices = reinterpret_cast<const index_t*>(uniqueVertexIB.data());
+        const size_t vertIndices = uniqueVertexIB.size() / sizeof(index_t);
+
+        using tri_t = std::tuple<uint32_t, uint32_t, uint32_t>;
+
+        auto canonical = [](uint32_t a, uint32_t b, uint32_t c) -> tri_t
+            {
+                if (b < a && b < c)
+                    return tri_t(b, c, a);
+                else if (c < a && c < b)
+                    return tri_t(c, a, b);
+                return tri_t(a, b, c);
+            };
+
+        std::vector<tri_t> expected;
+        expected.reserve(nFaces);
+        for (size_t j = 0; j < nFaces; ++j)
+        {
+            expected.emplace_back(canonical(indices[j * 3], indices[j * 3 + 1], indices[j * 3 + 2]));
+        }
+
+        std::vector<tri_t> actual;
+        actual.reserve(nFaces);
+        for (const auto& m : meshlets)
+        {
+            if (!IsValidMeshlet(m, vertIndices, primitiveIndices.size()))
+                return false;
+
+            if (m.VertCount > maxVerts || m.PrimCount > maxPrims)
+                return false;
+
+            for (uint32_t k = 0; k < m.PrimCount; ++k)
+            {
+                auto const& mtri = primitiveIndices[m.PrimOffset + k];
+                if (!IsValidMeshletTriangle(mtri, m.VertCount))
+                    return false;
+
+                const uint32_t i0 = uniqueVertexIndices[m.VertOffset + mtri.i0];
+                const uint32_t i1 = uniqueVertexIndices[m.VertOffset + mtri.i1];
+                const uint32_t i2 = uniqueVertexIndices[m.VertOffset + mtri.i2];
+                if (i0 >= nVerts || i1 >= nVerts || i2 >= nVerts)
+                    return false;
+
+                actual.emplace_back(canonical(i0, i1, i2));
+            }
+        }
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+
+        return (expected == actual);
+    }
+
+    // Verifies each bounding sphere contains its meshlet, and that a batched call matches per-meshlet calls
+    // (normal cones may differ by one quantization step)
+    template<typename index_t>
+    bool IsValidCullData(
+        _In_reads_(nVerts) const XMFLOAT3* positions, size_t nVerts,
+        const std::vector<Meshlet>& meshlets,
+        const std::vector<uint8_t>& uniqueVertexIB,
+        const std::vector<MeshletTriangle>& primitiveIndices,
+        _In_reads_(meshlets.size()) const CullData* cull)
+    {
+        auto uniqueVertexIndices = reinterpret_cast<const index_t*>(uniqueVertexIB.data());
+        const size_t vertIndices = uniqueVertexIB.size() / sizeof(index_t);
+
+        for (size_t j = 0; j < meshlets.size(); ++j)
+        {
+            const auto& m = meshlets[j];
+
+            const XMVECTOR center = XMLoadFloat3(&cull[j].BoundingSphere.Center);
+            const float radius = cull[j].BoundingSphere.Radius;
+
+            for (uint32_t k = 0; k < m.VertCount; ++k)
+            {
+                const index_t index = uniqueVertexIndices[m.VertOffset + k];
+                if (index >= nVerts)
+                    return false;
+
+                const XMVECTOR p = XMLoadFloat3(&positions[index]);
+                if (XMVectorGetX(XMVector3Length(XMVectorSubtract(p, center))) > radius + g_Epsilon)
+                    return false;
+            }
+
+            CullData single = {};
+            HRESULT hr = ComputeCullData(positions, nVerts,
+                &m, 1,
+                uniqueVertexIndices, vertIndices,
+                primitiveIndices.data(), primitiveIndices.size(), &single);
+            if (FAILED(hr))
+                return false;
+
+            if (fabsf(single.BoundingSphere.Radius - radius) > g_Epsilon
+                || !XMVector3NearEqual(XMLoadFloat3(&single.BoundingSphere.Center), center, XMVectorReplicate(g_Epsilon))
+                || abs(int(single.NormalCone.x) - int(cull[j].NormalCone.x)) > 1
+                || abs(int(single.NormalCone.y) - int(cull[j].NormalCone.y)) > 1
+                || abs(int(single.NormalCone.z) - int(cull[j].NormalCone.z)) > 1
+                || abs(int(single.NormalCone.w) - int(cull[j].NormalCone.w)) > 1
+                || fabsf(single.ApexOffset - cull[j].ApexOffset) > g_Epsilon)
+                return false;
+        }
+
+        return true;
+    }
+    // Creates a torus index buffer with a matching position-only vertex buffer
+    template<typename index_t>
+    void CreateTorusMesh(size_t tessellation, std::vector<index_t>& indices, std::unique_ptr<XMFLOAT3[]>& positions, size_t& nVerts)
+    {
+        std::vector<typename ShapesGenerator<index_t>::Vertex> vertices;
+        ShapesGenerator<index_t>::CreateTorus(indices, vertices, 1.f, 0.333f, tessellation, false);
+
+        nVerts = vertices.size();
+
+        positions.reset(new XMFLOAT3[nVerts]);
+        for (size_t j = 0; j < nVerts; ++j)
+            positions[j] = vertices[j].position;
+    }
 }
 
 //-------------------------------------------------------------------------------------
@@ -240,6 +370,117 @@ bool Test28()
         }
     }
 
+    // 16-bit torus
+    {
+        std::vector<uint16_t> indices;
+        std::unique_ptr<XMFLOAT3[]> positions;
+        size_t nVerts = 0;
+        CreateTorusMesh(128, indices, positions, nVerts);
+
+        const size_t nFaces = indices.size() / 3;
+
+        std::vector<Meshlet> meshlets;
+        std::vector<uint8_t> uniqueVertexIB;
+        std::vector<MeshletTriangle> primitiveIndices;
+        HRESULT hr = ComputeMeshlets(indices.data(), nFaces, positions.get(), nVerts, nullptr,
+            meshlets, uniqueVertexIB, primitiveIndices);
+        if (FAILED(hr))
+        {
+            printe("\nERROR: ComputeMeshlets(16) torus failed (%08X)\n", static_cast<unsigned int>(hr));
+            success = false;
+        }
+        else if (meshlets.size() < ((nFaces + MESHLET_DEFAULT_MAX_PRIMS - 1) / MESHLET_DEFAULT_MAX_PRIMS)
+            || meshlets.size() > 2 * ((nFaces + MESHLET_DEFAULT_MAX_PRIMS - 1) / MESHLET_DEFAULT_MAX_PRIMS)
+            || primitiveIndices.size() != nFaces)
+        {
+            printe("\nERROR: ComputeMeshlets(16) torus failed producing reasonable numbers of meshlets (%zu meshlets, %zu prims)\n",
+                meshlets.size(), primitiveIndices.size());
+            success = false;
+        }
+        else if (!IsValidMeshletCover(indices.data(), nFaces, nVerts, meshlets, uniqueVertexIB, primitiveIndices,
+            MESHLET_DEFAULT_MAX_VERTS, MESHLET_DEFAULT_MAX_PRIMS))
+        {
+            printe("\nERROR: ComputeMeshlets(16) torus produced meshlets that do not cover the mesh\n");
+            success = false;
+        }
+    }
+
+    // 32-bit torus
+    {
+        std::vector<uint32_t> indices;
+        std::unique_ptr<XMFLOAT3[]> positions;
+        size_t nVerts = 0;
+        CreateTorusMesh(256, indices, positions, nVerts);
+
+        const size_t nFaces = indices.size() / 3;
+
+        std::vector<Meshlet> meshlets;
+        std::vector<uint8_t> uniqueVertexIB;
+        std::vector<MeshletTriangle> primitiveIndices;
+        HRESULT hr = ComputeMeshlets(indices.data(), nFaces, positions.get(), nVerts, nullptr,
+            meshlets, uniqueVertexIB, primitiveIndices);
+        if (FAILED(hr))
+        {
+            printe("\nERROR: ComputeMeshlets(32) torus failed (%08X)\n", static_cast<unsigned int>(hr));
+            success = false;
+        }
+        else if (meshlets.size() < ((nFaces + MESHLET_DEFAULT_MAX_PRIMS - 1) / MESHLET_DEFAULT_MAX_PRIMS)
+            || meshlets.size() > 2 * ((nFaces + MESHLET_DEFAULT_MAX_PRIMS - 1) / MESHLET_DEFAULT_MAX_PRIMS)
+            || primitiveIndices.size() != nFaces)
+        {
+            printe("\nERROR: ComputeMeshlets(32) torus failed producing reasonable numbers of meshlets (%zu meshlets, %zu prims)\n",
+                meshlets.size(), primitiveIndices.size());
+            success = false;
+        }
+        else if (!IsValidMeshletCover(indices.data(), nFaces, nVerts, meshlets, uniqueVertexIB, primitiveIndices,
+            MESHLET_DEFAULT_MAX_VERTS, MESHLET_DEFAULT_MAX_PRIMS))
+        {
+            printe("\nERROR: ComputeMeshlets(32) torus produced meshlets that do not cover the mesh\n");
+            success = false;
+        }
+    }
+
+    // 32-bit torus with reduced limits
+    {
+        // Packed encodings size primitive indices from maxVerts, so non-default limits must hold exactly
+        std::vector<uint32_t> indices;
+        std::unique_ptr<XMFLOAT3[]> positions;
+        size_t nVerts = 0;
+        CreateTorusMesh(64, indices, positions, nVerts);
+
+        const size_t nFaces = indices.size() / 3;
+
+        static const size_t s_limits[][2] =
+        {
+            { 64, 126 },
+            { 32, 64 },
+            { 256, 256 },
+        };
+
+        for (size_t l = 0; l < std::size(s_limits); ++l)
+        {
+            const size_t maxVerts = s_limits[l][0];
+            const size_t maxPrims = s_limits[l][1];
+
+            std::vector<Meshlet> meshlets;
+            std::vector<uint8_t> uniqueVertexIB;
+            std::vector<MeshletTriangle> primitiveIndices;
+            HRESULT hr = ComputeMeshlets(indices.data(), nFaces, positions.get(), nVerts, nullptr,
+                meshlets, uniqueVertexIB, primitiveIndices, maxVerts, maxPrims);
+            if (FAILED(hr))
+            {
+                printe("\nERROR: ComputeMeshlets(32) torus %zu/%zu failed (%08X)\n", maxVerts, maxPrims, static_cast<unsigned int>(hr));
+                success = false;
+            }
+            else if (!IsValidMeshletCover(indices.data(), nFaces, nVerts, meshlets, uniqueVertexIB, primitiveIndices,
+                maxVerts, maxPrims))
+            {
+                printe("\nERROR: ComputeMeshlets(32) torus %zu/%zu produced meshlets that do not cover the mesh\n", maxVerts, maxPrims);
+                success = false;
+            }
+        }
+    }
+
     // 16-bit multiple submesh
     // TODO -
 
@@ -488,5 +729,89 @@ bool Test29()
         }
     }
 
+    // 16-bit torus
+    {
+        std::vector<uint16_t> indices;
+        std::unique_ptr<XMFLOAT3[]> positions;
+        size_t nVerts = 0;
+        CreateTorusMesh(128, indices, positions, nVerts);
+
+        const size_t nFaces = indices.size() / 3;
+
+        std::vector<Meshlet> meshlets;
+        std::vector<uint8_t> uniqueVertexIB;
+        std::vector<MeshletTriangle> primitiveIndices;
+        HRESULT hr = ComputeMeshlets(indices.data(), nFaces, positions.get(), nVerts, nullptr,
+            meshlets, uniqueVertexIB, primitiveIndices);
+        if (FAILED(hr))
+        {
+            printe("\nERROR: ComputeMeshlets(16) torus failed (%08X)\n", static_cast<unsigned int>(hr));
+            success = false;
+        }
+        else
+        {
+            auto uniqueVertexIndices = reinterpret_cast<const uint16_t*>(uniqueVertexIB.data());
+            size_t vertIndices = uniqueVertexIB.size() / sizeof(uint16_t);
+
+            std::unique_ptr<CullData[]> cull(new CullData[meshlets.size()]);
+            hr = ComputeCullData(positions.get(), nVerts,
+                meshlets.data(), meshlets.size(),
+                uniqueVertexIndices, vertIndices,
+                primitiveIndices.data(), primitiveIndices.size(), cull.get());
+            if (FAILED(hr))
+            {
+                printe("\nERROR: ComputeCullData(16) torus failed (%08X)\n", static_cast<unsigned int>(hr));
+                success = false;
+            }
+            else if (!IsValidCullData<uint16_t>(positions.get(), nVerts, meshlets, uniqueVertexIB, primitiveIndices, cull.get()))
+            {
+                printe("\nERROR: ComputeCullData(16) torus produced inconsistent cull data\n");
+                success = false;
+            }
+        }
+    }
+
+    // 32-bit torus
+    {
+        std::vector<uint32_t> indices;
+        std::unique_ptr<XMFLOAT3[]> positions;
+        size_t nVerts = 0;
+        CreateTorusMesh(256, indices, positions, nVerts);
+
+        const size_t nFaces = indices.size() / 3;
+
+        std::vector<Meshlet> meshlets;
+        std::vector<uint8_t> uniqueVertexIB;
+        std::vector<MeshletTriangle> primitiveIndices;
+        HRESULT hr = ComputeMeshlets(indices.data(), nFaces, positions.get(), nVerts, nullptr,
+            meshlets, uniqueVertexIB, primitiveIndices);
+        if (FAILED(hr))
+        {
+            printe("\nERROR: ComputeMeshlets(32) torus failed (%08X)\n", static_cast<unsigned int>(hr));
+            success = false;
+        }
+        else
+        {
+            auto uniqueVertexIndices = reinterpret_cast<const uint32_t*>(uniqueVertexIB.data());
+            size_t vertIndices = uniqueVertexIB.size() / sizeof(uint32_t);
+
+            std::unique_ptr<CullData[]> cull(new CullData[meshlets.size()]);
+            hr = ComputeCullData(positions.get(), nVerts,
+                meshlets.data(), meshlets.size(),
+                uniqueVertexIndices, vertIndices,
+                primitiveIndices.data(), primitiveIndices.size(), cull.get());
+            if (FAILED(hr))
+            {
+                printe("\nERROR: ComputeCullData(32) torus failed (%08X)\n", static_cast<unsigned int>(hr));
+                success = false;
+            }
+            else if (!IsValidCullData<uint32_t>(positions.get(), nVerts, meshlets, uniqueVertexIB, primitiveIndices, cull.get()))
+            {
+                printe("\nERROR: ComputeCullData(32) torus produced inconsistent cull data\n");
+                success = false;
+            }
+        }
+    }
+
     return success;
 }
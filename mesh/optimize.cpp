@@ -186,6 +186,87 @@ bool Test15()
         #pragma warning(pop)
     }
 
+    // large with many attributes
+    {
+        // Face count exceeds any parallel histogram threshold; attribute count spans more than one radix digit
+        constexpr size_t nFaces = 1048573;
+        constexpr uint32_t nAttr = 317;
+
+        std::vector<uint32_t> attributes(nFaces);
+        for (size_t j = 0; j < nFaces; ++j)
+        {
+            attributes[j] = static_cast<uint32_t>(((j * 2654435761u) >> 8) % nAttr);
+        }
+
+        const std::vector<uint32_t> original(attributes);
+
+        std::unique_ptr<uint32_t[]> remap(new uint32_t[nFaces]);
+        memset(remap.get(), 0xcd, sizeof(uint32_t) * nFaces);
+
+        HRESULT hr = AttributeSort(nFaces, attributes.data(), remap.get());
+        if (FAILED(hr))
+        {
+            success = false;
+            printe("ERROR: Attribute sort large failed (%08X)\n", static_cast<unsigned int>(hr));
+        }
+        else
+        {
+            std::vector<uint32_t> histogram(nAttr, 0);
+            for (size_t j = 0; j < nFaces; ++j)
+                ++histogram[original[j]];
+
+            bool valid = true;
+            for (size_t j = 0; j < nFaces; ++j)
+            {
+                const uint32_t f = remap[j];
+                if (f >= nFaces)
+                {
+                    valid = false;
+                    printe("ERROR: Attribute sort large failed, remap invalid at %zu (%u)\n", j, f);
+                    break;
+                }
+
+                if (attributes[j] != original[f])
+                {
+                    valid = false;
+                    printe("ERROR: Attribute sort large failed, attribute mismatch at %zu (%u .. %u)\n", j, attributes[j], original[f]);
+                    break;
+                }
+
+                if (j > 0)
+                {
+                    if (attributes[j - 1] > attributes[j])
+                    {
+                        valid = false;
+                        printe("ERROR: Attribute sort large failed, not sorted at %zu\n", j);
+                        break;
+                    }
+                    else if (attributes[j - 1] == attributes[j] && remap[j - 1] >= f)
+                    {
+                        valid = false;
+                        printe("ERROR: Attribute sort large failed, not stable at %zu\n", j);
+                        break;
+                    }
+                }
+
+                --histogram[attributes[j]];
+            }
+
+            for (uint32_t j = 0; valid && j < nAttr; ++j)
+            {
+                if (histogram[j] != 0)
+                {
+                    valid = false;
+                    printe("ERROR: Attribute sort large failed, attribute %u count mismatch\n", j);
+                    break;
+                }
+            }
+
+            if (!valid)
+                success = false;
+        }
+    }
+
     return success;
 }
 
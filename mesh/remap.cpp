@@ -2542,5 +2542,160 @@ bool Test18()
         }
     }
 
+    // Large (16)
+    {
+        // Face count chosen to exceed any serial threshold and to not be a multiple of a chunk size
+        constexpr size_t nFaces = 1048573;
+
+        std::unique_ptr<uint16_t[]> srcib(new uint16_t[nFaces * 3]);
+        for (size_t j = 0; j < nFaces * 3; ++j)
+            srcib[j] = uint16_t(j % 65521);
+
+        std::unique_ptr<uint32_t[]> remap(new uint32_t[nFaces]);
+        for (uint32_t j = 0; j < nFaces; ++j)
+            remap[j] = j;
+
+        std::shuffle(remap.get(), remap.get() + nFaces, rng);
+
+        // Unused faces are skipped rather than written, so prefill the destination
+        const uint32_t unusedFace = remap[nFaces / 2];
+        remap[nFaces / 2] = uint32_t(-1);
+
+        std::unique_ptr<uint16_t[]> destib(new uint16_t[nFaces * 3]);
+        memset(destib.get(), 0xff, sizeof(uint16_t) * nFaces * 3);
+
+        HRESULT hr = ReorderIB(srcib.get(), nFaces, remap.get(), destib.get());
+        if (FAILED(hr))
+        {
+            printe("ERROR: ReorderIB(16) large failed (%08X)\n", static_cast<unsigned int>(hr));
+            success = false;
+        }
+        else
+        {
+            for (size_t j = 0; j < nFaces; ++j)
+            {
+                uint32_t f = remap[j];
+
+                bool matches = (f == uint32_t(-1))
+                    ? (destib[j * 3] == uint16_t(-1) && destib[j * 3 + 1] == uint16_t(-1) && destib[j * 3 + 2] == uint16_t(-1))
+                    : (destib[j * 3] == srcib[f * 3] && destib[j * 3 + 1] == srcib[f * 3 + 1] && destib[j * 3 + 2] == srcib[f * 3 + 2]);
+
+                if (!matches)
+                {
+                    printe("ERROR: ReorderIB(16) large failed at face %zu\n", j);
+                    success = false;
+                    break;
+                }
+            }
+        }
+
+        // In-place swapping requires a complete permutation
+        remap[nFaces / 2] = unusedFace;
+
+        hr = ReorderIB(srcib.get(), nFaces, remap.get());
+        if (FAILED(hr))
+        {
+            printe("ERROR: ReorderIB(16) large [in-place] failed (%08X)\n", static_cast<unsigned int>(hr));
+            success = false;
+        }
+        else
+        {
+            for (size_t j = 0; j < nFaces; ++j)
+            {
+                uint32_t f = remap[j];
+
+                bool matches = true;
+                for (uint32_t k = 0; k < 3; ++k)
+                {
+                    if (srcib[j * 3 + k] != uint16_t((f * 3 + k) % 65521))
+                        matches = false;
+                }
+
+                if (!matches)
+                {
+                    printe("ERROR: ReorderIB(16) large [in-place] failed at face %zu\n", j);
+                    success = false;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Large (32)
+    {
+        constexpr size_t nFaces = 1048573;
+
+        auto srcib = CreateIndexBuffer<uint32_t>(nFaces * 3, IB_IDENTITY);
+
+        std::unique_ptr<uint32_t[]> remap(new uint32_t[nFaces]);
+        for (uint32_t j = 0; j < nFaces; ++j)
+            remap[j] = j;
+
+        std::shuffle(remap.get(), remap.get() + nFaces, rng);
+
+        // Unused faces are skipped rather than written, so prefill the destination
+        const uint32_t unusedFace = remap[nFaces / 2];
+        remap[nFaces / 2] = uint32_t(-1);
+
+        std::unique_ptr<uint32_t[]> destib(new uint32_t[nFaces * 3]);
+        memset(destib.get(), 0xff, sizeof(uint32_t) * nFaces * 3);
+
+        HRESULT hr = ReorderIB(srcib.get(), nFaces, remap.get(), destib.get());
+        if (FAILED(hr))
+        {
+            printe("ERROR: ReorderIB(32) large failed (%08X)\n", static_cast<unsigned int>(hr));
+            success = false;
+        }
+        else
+        {
+            for (size_t j = 0; j < nFaces; ++j)
+            {
+                uint32_t f = remap[j];
+
+                bool matches = (f == uint32_t(-1))
+                    ? (destib[j * 3] == uint32_t(-1) && destib[j * 3 + 1] == uint32_t(-1) && destib[j * 3 + 2] == uint32_t(-1))
+                    : (destib[j * 3] == (f * 3) && destib[j * 3 + 1] == (f * 3 + 1) && destib[j * 3 + 2] == (f * 3 + 2));
+
+                if (!matches)
+                {
+                    printe("ERROR: ReorderIB(32) large failed at face %zu\n", j);
+                    success = false;
+                    break;
+                }
+            }
+        }
+
+        // In-place swapping requires a complete permutation
+        remap[nFaces / 2] = unusedFace;
+
+        hr = ReorderIB(srcib.get(), nFaces, remap.get());
+        if (FAILED(hr))
+        {
+            printe("ERROR: ReorderIB(32) large [in-place] failed (%08X)\n", static_cast<unsigned int>(hr));
+            success = false;
+        }
+        else
+        {
+            for (size_t j = 0; j < nFaces; ++j)
+            {
+                uint32_t f = remap[j];
+
+                bool matches = true;
+                for (uint32_t k = 0; k < 3; ++k)
+                {
+                    if (srcib[j * 3 + k] != (f * 3 + k))
+                        matches = false;
+                }
+
+                if (!matches)
+                {
+                    printe("ERROR: ReorderIB(32) large [in-place] failed at face %zu\n", j);
+                    success = false;
+                    break;
+                }
+            }
+        }
+    }
+
     return success;
 }
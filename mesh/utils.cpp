@@ -651,5 +651,48 @@ bool Test24()
         }
     }
 
+    // large with varying run lengths
+    {
+        // Run lengths cover both short runs and runs that straddle any vector-width boundary
+        constexpr size_t nFaces = 1048573;
+
+        std::vector<uint32_t> attr;
+        attr.reserve(nFaces);
+
+        std::vector<std::pair<size_t, size_t>> expected;
+
+        uint32_t id = 0;
+        size_t runLength = 1;
+        while (attr.size() < nFaces)
+        {
+            const size_t count = std::min(runLength, nFaces - attr.size());
+            expected.emplace_back(attr.size(), count);
+            attr.insert(attr.end(), count, id);
+
+            id = (id + 7) % 311;
+            runLength = (runLength % 67) + 1;
+        }
+
+        auto subsets = ComputeSubsets( attr.data(), attr.size() );
+        if ( subsets.size() != expected.size() )
+        {
+            printe("ERROR: ComputeSubsets large failed count %zu .. %zu\n", subsets.size(), expected.size() );
+            success = false;
+        }
+        else
+        {
+            for (size_t j = 0; j < expected.size(); ++j)
+            {
+                if (subsets[j] != expected[j])
+                {
+                    printe("ERROR: ComputeSubsets large failed %zu: %zu,%zu .. %zu,%zu\n", j,
+                        subsets[j].first, subsets[j].second, expected[j].first, expected[j].second);
+                    success = false;
+                    break;
+                }
+            }
+        }
+    }
+
     return success;
 }
@@ -326,6 +326,183 @@ namespace
         uint32_t(-1), uint32_t(-1), uint32_t(-1),
         uint32_t(-1), uint32_t(-1), uint32_t(-1),
     };
+
+    // Regular grid of nGrid x nGrid quads with consistent winding
+    template<class index_t>
+    std::unique_ptr<index_t[]> CreateGridIndices(uint32_t nGrid)
+    {
+        std::unique_ptr<index_t[]> ib(new index_t[size_t(nGrid) * nGrid * 6]);
+
+        index_t* ptr = ib.get();
+        for (uint32_t y = 0; y < nGrid; ++y)
+        {
+            for (uint32_t x = 0; x < nGrid; ++x)
+            {
+                const uint32_t v0 = y * (nGrid + 1) + x;
+                const uint32_t v2 = v0 + nGrid + 1;
+
+                *ptr++ = index_t(v0);
+                *ptr++ = index_t(v0 + 1);
+                *ptr++ = index_t(v2);
+
+                *ptr++ = index_t(v0 + 1);
+                *ptr++ = index_t(v2 + 1);
+                *ptr++ = index_t(v2);
+            }
+        }
+
+        return ib;
+    }
+
+    // Large meshes with defects placed at the start, middle, and end of the index buffer
+    template<class index_t>
+    bool ValidateLargeGrid(uint32_t nGrid)
+    {
+        bool success = true;
+
+        const size_t bits = sizeof(index_t) * 8;
+        const size_t nFaces = size_t(nGrid) * nGrid * 2;
+        const size_t nVerts = size_t(nGrid + 1) * (nGrid + 1);
+
+        auto ib = CreateGridIndices<index_t>(nGrid);
+
+        std::wstring msgs;
+        HRESULT hr = Validate(ib.get(), nFaces, nVerts, nullptr, VALIDATE_DEFAULT | VALIDATE_DEGENERATE | VALIDATE_UNUSED, &msgs);
+        if (FAILED(hr))
+        {
+            printe("ERROR: Validate(%zu) large grid failed (%08X)\n%ls\n", bits, static_cast<unsigned int>(hr), msgs.c_str());
+            success = false;
+        }
+
+        hr = Validate(ib.get(), nFaces, nVerts, nullptr, VALIDATE_DEFAULT | VALIDATE_DEGENERATE | VALIDATE_UNUSED, nullptr);
+        if (FAILED(hr))
+        {
+            printe("ERROR: Validate(%zu) large grid [no msgs] failed (%08X)\n", bits, static_cast<unsigned int>(hr));
+            success = false;
+        }
+
+        const size_t faces[] = { 0, nFaces / 2, nFaces - 1 };
+
+        // Bad indices
+        for (size_t j = 0; j < std::size(faces); ++j)
+        {
+            const size_t index = faces[j] * 3 + (j % 3);
+            const index_t orig = ib[index];
+            ib[index] = index_t(nVerts);
+
+            hr = Validate(ib.get(), nFaces, nVerts, nullptr, VALIDATE_DEFAULT, &msgs);
+            if (hr != E_FAIL || msgs.empty())
+            {
+                printe("ERROR: Validate(%zu) large grid [bad index face %zu] didn't fail as expected (%08X)\n", bits, faces[j], static_cast<unsigned int>(hr));
+                success = false;
+            }
+
+            std::wstring msgs2;
+            hr = Validate(ib.get(), nFaces, nVerts, nullptr, VALIDATE_DEFAULT, &msgs2);
+            if (hr != E_FAIL || msgs != msgs2)
+            {
+                printe("ERROR: Validate(%zu) large grid [bad index face %zu] diagnostics not repeatable (%08X)\n%ls\n%ls\n",
+                    bits, faces[j], static_cast<unsigned int>(hr), msgs.c_str(), msgs2.c_str());
+                success = false;
+            }
+
+            hr = Validate(ib.get(), nFaces, nVerts, nullptr, VALIDATE_DEFAULT, nullptr);
+            if (hr != E_FAIL)
+            {
+                printe("ERROR: Validate(%zu) large grid [bad index face %zu, no msgs] didn't fail as expected (%08X)\n", bits, faces[j], static_cast<unsigned int>(hr));
+                success = false;
+            }
+
+            ib[index] = orig;
+        }
+
+        // Every defect is reported, not just the first one found
+        {
+            std::wstring first;
+            ib[0] = index_t(nVerts);
+            hr = Validate(ib.get(), nFaces, nVerts, nullptr, VALIDATE_DEFAULT, &first);
+
+            ib[nFaces * 3 - 1] = index_t(nVerts);
+            std::wstring both;
+            HRESULT hr2 = Validate(ib.get(), nFaces, nVerts, nullptr, VALIDATE_DEFAULT, &both);
+            if (hr != E_FAIL || hr2 != E_FAIL || both.size() <= first.size() || both.compare(0, first.size(), first) != 0)
+            {
+                printe("ERROR: Validate(%zu) large grid [two bad indices] failed to report both (%08X, %08X)\n%ls\n%ls\n",
+                    bits, static_cast<unsigned int>(hr), static_cast<unsigned int>(hr2), first.c_str(), both.c_str());
+                success = false;
+            }
+
+            ib = CreateGridIndices<index_t>(nGrid);
+        }
+
+        // Degenerate
+        for (size_t j = 0; j < std::size(faces); ++j)
+        {
+            const size_t index = faces[j] * 3;
+            const index_t orig = ib[index + 1];
+            ib[index + 1] = ib[index];
+
+            hr = Validate(ib.get(), nFaces, nVerts, nullptr, VALIDATE_DEFAULT, &msgs);
+            if (FAILED(hr))
+            {
+                printe("ERROR: Validate(%zu) large grid [degen face %zu] failed (%08X)\n%ls\n", bits, faces[j], static_cast<unsigned int>(hr), msgs.c_str());
+                success = false;
+            }
+
+            hr = Validate(ib.get(), nFaces, nVerts, nullptr, VALIDATE_DEGENERATE, &msgs);
+            if (hr != E_FAIL || msgs.empty())
+            {
+                printe("ERROR: Validate(%zu) large grid [degen face %zu] didn't fail as expected (%08X)\n", bits, faces[j], static_cast<unsigned int>(hr));
+                success = false;
+            }
+
+            hr = Validate(ib.get(), nFaces, nVerts, nullptr, VALIDATE_DEGENERATE, nullptr);
+            if (hr != E_FAIL)
+            {
+                printe("ERROR: Validate(%zu) large grid [degen face %zu, no msgs] didn't fail as expected (%08X)\n", bits, faces[j], static_cast<unsigned int>(hr));
+                success = false;
+            }
+
+            ib[index + 1] = orig;
+        }
+
+        // Unused
+        for (size_t j = 0; j < std::size(faces); ++j)
+        {
+            const size_t index = faces[j] * 3;
+            const index_t orig[3] = { ib[index], ib[index + 1], ib[index + 2] };
+
+            ib[index] = ib[index + 1] = ib[index + 2] = index_t(-1);
+
+            hr = Validate(ib.get(), nFaces, nVerts, nullptr, VALIDATE_DEFAULT | VALIDATE_UNUSED, &msgs);
+            if (FAILED(hr))
+            {
+                printe("ERROR: Validate(%zu) large grid [unused face %zu] failed (%08X)\n%ls\n", bits, faces[j], static_cast<unsigned int>(hr), msgs.c_str());
+                success = false;
+            }
+
+            ib[index + 1] = orig[1];
+
+            hr = Validate(ib.get(), nFaces, nVerts, nullptr, VALIDATE_DEFAULT, &msgs);
+            if (FAILED(hr))
+            {
+                printe("ERROR: Validate(%zu) large grid [ignore partial unused face %zu] failed (%08X)\n%ls\n", bits, faces[j], static_cast<unsigned int>(hr), msgs.c_str());
+                success = false;
+            }
+
+            hr = Validate(ib.get(), nFaces, nVerts, nullptr, VALIDATE_UNUSED, &msgs);
+            if (hr != E_FAIL || msgs.empty())
+            {
+                printe("ERROR: Validate(%zu) large grid [partial unused face %zu] didn't fail as expected (%08X)\n", bits, faces[j], static_cast<unsigned int>(hr));
+                success = false;
+            }
+
+            ib[index] = orig[0];
+            ib[index + 2] = orig[2];
+        }
+
+        return success;
+    }
 }
 
 
@@ -751,6 +928,13 @@ bool Test06()
         #pragma warning(pop)
     }
 
+    // Large meshes
+    if (!ValidateLargeGrid<uint16_t>(180))
+        success = false;
+
+    if (!ValidateLargeGrid<uint32_t>(512))
+        success = false;
+
     return success;
 }
 
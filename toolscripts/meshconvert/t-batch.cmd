@@ -0,0 +1,78 @@
+@echo off
+call startup.cmd %0
+
+REM Converting several files in one run must match single-file runs byte-for-byte
+
+for %%i in ("%RUN%") do set RUNABS=%%~fi
+for %%i in ("%OUTTESTDIR%\batch") do set BATCHDIR=%%~fi
+
+if exist "%BATCHDIR%" rd /s /q "%BATCHDIR%"
+md "%BATCHDIR%"
+copy /y %REFDIR%\cup._obj "%BATCHDIR%" >nul
+copy /y %REFDIR%\cup.mtl "%BATCHDIR%" >nul
+copy /y %REFDIR%\teapot._obj "%BATCHDIR%" >nul
+copy /y %REFDIR%\Head_Big_Ears._obj "%BATCHDIR%" >nul
+copy /y %REFDIR%\Head_Big_Ears.mtl "%BATCHDIR%" >nul
+
+echo.
+echo -nologo -c -op -o %OUTTESTDIR%\cup.sdkmesh %REFDIR%\cup._obj
+"%RUN%" -nologo -c -op -o %OUTTESTDIR%\cup.sdkmesh %REFDIR%\cup._obj
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Failed" )
+
+echo.
+echo -nologo -c -op -o %OUTTESTDIR%\teapot.sdkmesh %REFDIR%\teapot._obj
+"%RUN%" -nologo -c -op -o %OUTTESTDIR%\teapot.sdkmesh %REFDIR%\teapot._obj
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Failed" )
+
+echo.
+echo -nologo -c -op -o %OUTTESTDIR%\Head_Big_Ears.sdkmesh %REFDIR%\Head_Big_Ears._obj
+"%RUN%" -nologo -c -op -o %OUTTESTDIR%\Head_Big_Ears.sdkmesh %REFDIR%\Head_Big_Ears._obj
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Failed" )
+
+pushd "%BATCHDIR%"
+
+echo.
+echo -nologo -c -op -y cup._obj teapot._obj Head_Big_Ears._obj
+"%RUNABS%" -nologo -c -op -y cup._obj teapot._obj Head_Big_Ears._obj
+if %ERRORLEVEL% NEQ 0 ( popd & call failure.cmd "Failed" )
+
+popd
+
+fc /b %OUTTESTDIR%\cup.sdkmesh "%BATCHDIR%\cup.sdkmesh" >nul
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Batch output for cup differs" )
+
+fc /b %OUTTESTDIR%\teapot.sdkmesh "%BATCHDIR%\teapot.sdkmesh" >nul
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Batch output for teapot differs" )
+
+fc /b %OUTTESTDIR%\Head_Big_Ears.sdkmesh "%BATCHDIR%\Head_Big_Ears.sdkmesh" >nul
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Batch output for Head_Big_Ears differs" )
+
+del /q "%BATCHDIR%\*.sdkmesh"
+
+REM Move one input into a subdirectory so the wildcard search has to recurse to find it
+md "%BATCHDIR%\sub"
+move /y "%BATCHDIR%\Head_Big_Ears._obj" "%BATCHDIR%\sub" >nul
+move /y "%BATCHDIR%\Head_Big_Ears.mtl" "%BATCHDIR%\sub" >nul
+
+pushd "%BATCHDIR%"
+
+echo.
+echo -nologo -c -op -y -r *._obj
+"%RUNABS%" -nologo -c -op -y -r *._obj
+if %ERRORLEVEL% NEQ 0 ( popd & call failure.cmd "Failed" )
+
+popd
+
+fc /b %OUTTESTDIR%\cup.sdkmesh "%BATCHDIR%\cup.sdkmesh" >nul
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Wildcard output for cup differs" )
+
+fc /b %OUTTESTDIR%\teapot.sdkmesh "%BATCHDIR%\teapot.sdkmesh" >nul
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Wildcard output for teapot differs" )
+
+REM Accept the output either next to the source or in the working directory
+set SUBOUT=%BATCHDIR%\sub\Head_Big_Ears.sdkmesh
+if not exist "%SUBOUT%" set SUBOUT=%BATCHDIR%\Head_Big_Ears.sdkmesh
+if not exist "%SUBOUT%" ( call failure.cmd "Recursive search did not convert sub\Head_Big_Ears._obj" )
+
+fc /b %OUTTESTDIR%\Head_Big_Ears.sdkmesh "%SUBOUT%" >nul
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Recursive output for Head_Big_Ears differs" )
@@ -0,0 +1,38 @@
+@echo off
+call startup.cmd %0
+
+REM Repeated runs with the same options must reproduce the same bytes
+
+echo.
+echo -nologo -c -op -o %OUTTESTDIR%\cup.sdkmesh %REFDIR%\cup._obj
+"%RUN%" -nologo -c -op -o %OUTTESTDIR%\cup.sdkmesh %REFDIR%\cup._obj
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Failed" )
+
+echo.
+echo -nologo -c -op -o %OUTTESTDIR%\cup2.sdkmesh %REFDIR%\cup._obj
+"%RUN%" -nologo -c -op -o %OUTTESTDIR%\cup2.sdkmesh %REFDIR%\cup._obj
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Failed" )
+
+fc /b %OUTTESTDIR%\cup.sdkmesh %OUTTESTDIR%\cup2.sdkmesh >nul
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Repeated conversion of cup differs" )
+
+echo.
+echo -nologo -c -op -y -o %OUTTESTDIR%\cup2.sdkmesh %REFDIR%\cup._obj
+"%RUN%" -nologo -c -op -y -o %OUTTESTDIR%\cup2.sdkmesh %REFDIR%\cup._obj
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Failed" )
+
+fc /b %OUTTESTDIR%\cup.sdkmesh %OUTTESTDIR%\cup2.sdkmesh >nul
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Overwritten conversion of cup differs" )
+
+echo.
+echo -nologo -c -op -o %OUTTESTDIR%\Head_Big_Ears.sdkmesh %REFDIR%\Head_Big_Ears._obj
+"%RUN%" -nologo -c -op -o %OUTTESTDIR%\Head_Big_Ears.sdkmesh %REFDIR%\Head_Big_Ears._obj
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Failed" )
+
+echo.
+echo -nologo -c -op -o %OUTTESTDIR%\Head_Big_Ears2.sdkmesh %REFDIR%\Head_Big_Ears._obj
+"%RUN%" -nologo -c -op -o %OUTTESTDIR%\Head_Big_Ears2.sdkmesh %REFDIR%\Head_Big_Ears._obj
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Failed" )
+
+fc /b %OUTTESTDIR%\Head_Big_Ears.sdkmesh %OUTTESTDIR%\Head_Big_Ears2.sdkmesh >nul
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Repeated conversion of Head_Big_Ears differs" )
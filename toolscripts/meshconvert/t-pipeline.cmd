@@ -0,0 +1,67 @@
+@echo off
+call startup.cmd %0
+
+REM Output of the full stage chain must not depend on the order or company of other files in the run
+
+for %%i in ("%RUN%") do set RUNABS=%%~fi
+for %%i in ("%OUTTESTDIR%\pipeline") do set PIPEDIR=%%~fi
+
+if not exist "%PIPEDIR%" md "%PIPEDIR%"
+copy /y %REFDIR%\cup._obj "%PIPEDIR%" >nul
+copy /y %REFDIR%\cup.mtl "%PIPEDIR%" >nul
+copy /y %REFDIR%\teapot._obj "%PIPEDIR%" >nul
+copy /y %REFDIR%\Head_Big_Ears._obj "%PIPEDIR%" >nul
+copy /y %REFDIR%\Head_Big_Ears.mtl "%PIPEDIR%" >nul
+
+echo.
+echo -nologo -n -c -op -o %OUTTESTDIR%\cup_pipeline.sdkmesh %REFDIR%\cup._obj
+"%RUN%" -nologo -n -c -op -o %OUTTESTDIR%\cup_pipeline.sdkmesh %REFDIR%\cup._obj
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Failed" )
+
+echo.
+echo -nologo -n -c -op -o %OUTTESTDIR%\teapot_pipeline.sdkmesh %REFDIR%\teapot._obj
+"%RUN%" -nologo -n -c -op -o %OUTTESTDIR%\teapot_pipeline.sdkmesh %REFDIR%\teapot._obj
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Failed" )
+
+echo.
+echo -nologo -n -c -op -o %OUTTESTDIR%\Head_Big_Ears_pipeline.sdkmesh %REFDIR%\Head_Big_Ears._obj
+"%RUN%" -nologo -n -c -op -o %OUTTESTDIR%\Head_Big_Ears_pipeline.sdkmesh %REFDIR%\Head_Big_Ears._obj
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Failed" )
+
+pushd "%PIPEDIR%"
+
+echo.
+echo -nologo -n -c -op -y Head_Big_Ears._obj teapot._obj cup._obj
+"%RUNABS%" -nologo -n -c -op -y Head_Big_Ears._obj teapot._obj cup._obj
+if %ERRORLEVEL% NEQ 0 ( popd & call failure.cmd "Failed" )
+
+popd
+
+fc /b %OUTTESTDIR%\cup_pipeline.sdkmesh "%PIPEDIR%\cup.sdkmesh" >nul
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Reordered output for cup differs" )
+
+fc /b %OUTTESTDIR%\teapot_pipeline.sdkmesh "%PIPEDIR%\teapot.sdkmesh" >nul
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Reordered output for teapot differs" )
+
+fc /b %OUTTESTDIR%\Head_Big_Ears_pipeline.sdkmesh "%PIPEDIR%\Head_Big_Ears.sdkmesh" >nul
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Reordered output for Head_Big_Ears differs" )
+
+del /q "%PIPEDIR%\*.sdkmesh"
+
+pushd "%PIPEDIR%"
+
+echo.
+echo -nologo -n -c -op -y teapot._obj Head_Big_Ears._obj cup._obj teapot._obj
+"%RUNABS%" -nologo -n -c -op -y teapot._obj Head_Big_Ears._obj cup._obj teapot._obj
+if %ERRORLEVEL% NEQ 0 ( popd & call failure.cmd "Failed" )
+
+popd
+
+fc /b %OUTTESTDIR%\cup_pipeline.sdkmesh "%PIPEDIR%\cup.sdkmesh" >nul
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Interleaved output for cup differs" )
+
+fc /b %OUTTESTDIR%\teapot_pipeline.sdkmesh "%PIPEDIR%\teapot.sdkmesh" >nul
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Interleaved output for teapot differs" )
+
+fc /b %OUTTESTDIR%\Head_Big_Ears_pipeline.sdkmesh "%PIPEDIR%\Head_Big_Ears.sdkmesh" >nul
+if %ERRORLEVEL% NEQ 0 ( call failure.cmd "Interleaved output for Head_Big_Ears differs" )
@@ -541,6 +541,98 @@ bool Test06()
         }
     }
 
+    // every position, component and texcoord format combination must be self-consistent
+    {
+        static const uint32_t s_positions[] =
+        {
+            D3DFVF_XYZ, D3DFVF_XYZRHW, D3DFVF_XYZW,
+            D3DFVF_XYZB1, D3DFVF_XYZB2, D3DFVF_XYZB3, D3DFVF_XYZB4, D3DFVF_XYZB5,
+            D3DFVF_XYZB4 | D3DFVF_LASTBETA_UBYTE4, D3DFVF_XYZB5 | D3DFVF_LASTBETA_UBYTE4, D3DFVF_XYZB5 | D3DFVF_LASTBETA_D3DCOLOR,
+        };
+
+        static const uint32_t s_texFormats[] =
+        {
+            D3DFVF_TEXTUREFORMAT1, D3DFVF_TEXTUREFORMAT2, D3DFVF_TEXTUREFORMAT3, D3DFVF_TEXTUREFORMAT4,
+        };
+
+        size_t ncount = 0;
+        for (size_t p = 0; p < std::size(s_positions); ++p)
+        {
+            // Only five betas and the last-beta index variants don't round-trip through a decl
+            const bool roundTrip = (s_positions[p] & D3DFVF_POSITION_MASK) != D3DFVF_XYZB5
+                && !(s_positions[p] & (D3DFVF_LASTBETA_UBYTE4 | D3DFVF_LASTBETA_D3DCOLOR));
+
+            for (uint32_t components = 0; components < 16; ++components)
+            {
+                uint32_t fvf = s_positions[p];
+                if (components & 0x1)
+                    fvf |= D3DFVF_NORMAL;
+                if (components & 0x2)
+                    fvf |= D3DFVF_PSIZE;
+                if (components & 0x4)
+                    fvf |= D3DFVF_DIFFUSE;
+                if (components & 0x8)
+                    fvf |= D3DFVF_SPECULAR;
+
+                for (uint32_t texCount = 0; texCount <= 8; ++texCount)
+                {
+                    // Rotate the per-set texcoord formats so each set sees every format
+                    for (size_t rot = 0; rot < ((texCount > 0) ? std::size(s_texFormats) : 1); ++rot)
+                    {
+                        uint32_t code = fvf | (texCount << D3DFVF_TEXCOUNT_SHIFT);
+                        for (uint32_t t = 0; t < texCount; ++t)
+                        {
+                            code |= s_texFormats[(t + rot) % std::size(s_texFormats)] << (t * 2 + 16);
+                        }
+
+                        std::vector<D3DVERTEXELEMENT9> decl;
+                        if (!FVF::CreateDeclFromFVF(code, decl))
+                        {
+                            if ((code & D3DFVF_POSITION_MASK) == D3DFVF_XYZB5 && !(code & (D3DFVF_LASTBETA_UBYTE4 | D3DFVF_LASTBETA_D3DCOLOR)))
+                                continue;
+
+                            success = false;
+                            printf("\nERROR: combination %08X failed\n", code);
+                            continue;
+                        }
+
+                        ++ncount;
+
+                        if (FVF::GetDeclLength(decl.data()) != decl.size() - 1)
+                        {
+                            success = false;
+                            printf("\nERROR: combination %08X: decl length %zu .. %zu\n", code, FVF::GetDeclLength(decl.data()), decl.size() - 1);
+                        }
+
+                        const size_t vsize = FVF::ComputeVertexSize(code);
+                        const size_t declSize = FVF::ComputeVertexSize(decl.data(), 0);
+                        if (vsize == 0 || vsize != declSize)
+                        {
+                            success = false;
+                            printf("\nERROR: combination %08X: vertex size %zu .. %zu\n", code, vsize, declSize);
+                        }
+
+                        if (roundTrip)
+                        {
+                            const uint32_t fvfCode = FVF::ComputeFVF(decl.data());
+                            if (fvfCode != code)
+                            {
+                                success = false;
+                                printf("\nERROR: combination %08X: round-trip %08X\n", code, fvfCode);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        if (!ncount)
+        {
+            success = false;
+            printf("\nERROR: no combinations tested\n");
+        }
+    }
+
     // invalid args
     std::vector<D3DVERTEXELEMENT9> decl;
     if (FVF::CreateDeclFromFVF(D3DFVF_RESERVED0, decl) != 0)
@@ -5,6 +5,16 @@
 
 #include "directxtest.h"
 
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
 namespace
 {
     enum : uint32_t
@@ -57,6 +67,88 @@ namespace
         // TODO: Need files with the following extended mtls: Ke, map_Ks, norm, map_emissive, map_ORM
     #endif
     };
+
+    // Writes text to a uniquely named file in the temp directory
+    bool WriteTempFile(_In_z_ const char* content, wchar_t (&path)[MAX_PATH])
+    {
+        wchar_t tempPath[MAX_PATH] = {};
+        if (!GetTempPathW(MAX_PATH, tempPath))
+            return false;
+
+        if (!GetTempFileNameW(tempPath, L"obj", 0, path))
+            return false;
+
+        std::ofstream outFile(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!outFile)
+            return false;
+
+        outFile.write(content, static_cast<std::streamsize>(strlen(content)));
+        outFile.close();
+        return !outFile.fail();
+    }
+
+    // Zero-based position indices for a unit grid of nGrid x nGrid quads, two triangles per quad
+    std::vector<uint32_t> CreateGridFaces(uint32_t nGrid)
+    {
+        std::vector<uint32_t> faces;
+        faces.reserve(size_t(nGrid) * nGrid * 6);
+        for (uint32_t y = 0; y < nGrid; ++y)
+        {
+            for (uint32_t x = 0; x < nGrid; ++x)
+            {
+                const uint32_t i0 = y * (nGrid + 1) + x;
+                const uint32_t i1 = i0 + 1;
+                const uint32_t i2 = i0 + nGrid + 1;
+                const uint32_t i3 = i2 + 1;
+                faces.insert(faces.end(), { i0, i1, i3, i0, i3, i2 });
+            }
+        }
+        return faces;
+    }
+
+    // Creates OBJ text for the grid positions and the given faces, all sharing a single normal
+    std::string CreateGridOBJ(uint32_t nGrid, const std::vector<uint32_t>& faces)
+    {
+        std::string text;
+        for (uint32_t y = 0; y <= nGrid; ++y)
+        {
+            for (uint32_t x = 0; x <= nGrid; ++x)
+            {
+                text += "v " + std::to_string(x) + " " + std::to_string(y) + " 0\n";
+            }
+        }
+        text += "vn 0 0 1\n";
+        for (size_t j = 0; j < faces.size(); j += 3)
+        {
+            text += "f";
+            for (size_t k = 0; k < 3; ++k)
+            {
+                text += " " + std::to_string(faces[j + k] + 1) + "//1";
+            }
+            text += "\n";
+        }
+        return text;
+    }
+
+    std::string CreateGridOBJ(uint32_t nGrid)
+    {
+        return CreateGridOBJ(nGrid, CreateGridFaces(nGrid));
+    }
+
+    template<class index_t>
+    bool IsSameMesh(const DX::WaveFrontReader<index_t>& a, const DX::WaveFrontReader<index_t>& b)
+    {
+        if (a.vertices.size() != b.vertices.size()
+            || a.indices != b.indices
+            || a.attributes != b.attributes
+            || a.materials.size() != b.materials.size()
+            || a.hasNormals != b.hasNormals
+            || a.hasTexcoords != b.hasTexcoords)
+            return false;
+
+        return a.vertices.empty()
+            || memcmp(a.vertices.data(), b.vertices.data(), sizeof(typename DX::WaveFrontReader<index_t>::Vertex) * a.vertices.size()) == 0;
+    }
 }
 
 bool Test01()
@@ -184,6 +276,375 @@ bool Test01()
         ++ncount;
     }
 
+    // whitespace, line endings and number spellings must not change the parsed mesh
+    {
+        static const char* s_canonical =
+            "v 0 0 0\n"
+            "v 1 0 0\n"
+            "v 1 1 0\n"
+            "v 0 1 0\n"
+            "vn 0 0 1\n"
+            "vt 0 0\n"
+            "vt 1 0\n"
+            "vt 1 1\n"
+            "vt 0 1\n"
+            "f 1/1/1 2/2/1 3/3/1\n"
+            "f 1/1/1 3/3/1 4/4/1\n";
+
+        static const char* s_variants[] =
+        {
+            // CRLF line endings
+            "v 0 0 0\r\n"
+            "v 1 0 0\r\n"
+            "v 1 1 0\r\n"
+            "v 0 1 0\r\n"
+            "vn 0 0 1\r\n"
+            "vt 0 0\r\n"
+            "vt 1 0\r\n"
+            "vt 1 1\r\n"
+            "vt 0 1\r\n"
+            "f 1/1/1 2/2/1 3/3/1\r\n"
+            "f 1/1/1 3/3/1 4/4/1\r\n",
+
+            // Tabs, repeated and trailing whitespace, blank and comment lines
+            "# comment\n"
+            "\n"
+            "v\t0\t0\t0\n"
+            "v  1  0  0  \n"
+            "  v 1 1 0\n"
+            "v 0 1 0\t\n"
+            "\n"
+            "vn 0 0 1\n"
+            "# another comment\n"
+            "vt 0 0\n"
+            "vt 1 0\n"
+            "vt 1 1\n"
+            "vt 0 1\n"
+            "f\t1/1/1\t2/2/1\t3/3/1\n"
+            "f 1/1/1  3/3/1  4/4/1 \n",
+
+            // Alternate number spellings and no final newline
+            "v 0.0 0.00 0.000\n"
+            "v 1.0 0e0 0\n"
+            "v 1e0 1.000 0\n"
+            "v 0 10e-1 0\n"
+            "vn 0 0 1.0\n"
+            "vt 0 0\n"
+            "vt 1.0 0\n"
+            "vt 1 1.0\n"
+            "vt 0 +1\n"
+            "f 1/1/1 2/2/1 3/3/1\n"
+            "f 1/1/1 3/3/1 4/4/1",
+        };
+
+        wchar_t szPath[MAX_PATH] = {};
+        DX::WaveFrontReader<uint16_t> canonical;
+
+        HRESULT hr = E_FAIL;
+        if (WriteTempFile(s_canonical, szPath))
+        {
+            hr = canonical.Load(szPath);
+            std::ignore = DeleteFileW(szPath);
+        }
+
+        if (FAILED(hr) || canonical.vertices.size() != 4 || canonical.indices.size() != 6)
+        {
+            printf("ERROR: WaveFront OBJ canonical text load failed (%08X)\n", static_cast<unsigned int>(hr));
+            success = false;
+        }
+        else
+        {
+            for (size_t j = 0; j < std::size(s_variants); ++j)
+            {
+                DX::WaveFrontReader<uint16_t> wfReader;
+
+                hr = E_FAIL;
+                if (WriteTempFile(s_variants[j], szPath))
+                {
+                    hr = wfReader.Load(szPath);
+                    std::ignore = DeleteFileW(szPath);
+                }
+
+                if (FAILED(hr))
+                {
+                    printf("ERROR: WaveFront OBJ text variant %zu load failed (%08X)\n", j, static_cast<unsigned int>(hr));
+                    success = false;
+                }
+                else if (!IsSameMesh(canonical, wfReader))
+                {
+                    printf("ERROR: WaveFront OBJ text variant %zu does not match canonical text\n", j);
+                    success = false;
+                }
+            }
+        }
+    }
+
+    // vertices must be created in first-reference order, identically across concurrent loads
+    {
+        constexpr uint32_t nGrid = 40;
+        constexpr uint32_t nFaces = nGrid * nGrid * 2;
+
+        std::vector<uint32_t> faces = CreateGridFaces(nGrid);
+
+        // Shuffle the face order so first-reference order differs from position order
+        uint32_t seed = 0x2545F491u;
+        for (uint32_t j = nFaces - 1; j > 0; --j)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const uint32_t k = seed % (j + 1);
+            std::swap_ranges(faces.begin() + j * 3, faces.begin() + j * 3 + 3, faces.begin() + k * 3);
+        }
+
+        const std::string text = CreateGridOBJ(nGrid, faces);
+
+        std::vector<uint32_t> firstUse;
+        {
+            std::vector<bool> seen((nGrid + 1) * (nGrid + 1), false);
+            for (auto it : faces)
+            {
+                if (!seen[it])
+                {
+                    seen[it] = true;
+                    firstUse.push_back(it);
+                }
+            }
+        }
+
+        wchar_t szPath[MAX_PATH] = {};
+        if (!WriteTempFile(text.c_str(), szPath))
+        {
+            printf("ERROR: Failed writing WaveFront OBJ temp file\n");
+            success = false;
+        }
+        else
+        {
+            DX::WaveFrontReader<uint16_t> serial;
+            HRESULT hr = serial.Load(szPath);
+            if (FAILED(hr))
+            {
+                printf("ERROR: WaveFront OBJ grid load failed (%08X)\n", static_cast<unsigned int>(hr));
+                success = false;
+            }
+            else if (serial.vertices.size() != firstUse.size() || serial.indices.size() != faces.size())
+            {
+                printf("ERROR: WaveFront OBJ grid load: verts %zu .. %zu, inds %zu .. %zu\n",
+                    serial.vertices.size(), firstUse.size(), serial.indices.size(), faces.size());
+                success = false;
+            }
+            else
+            {
+                for (size_t j = 0; j < firstUse.size(); ++j)
+                {
+                    const auto& pos = serial.vertices[j].position;
+                    if (pos.x != float(firstUse[j] % (nGrid + 1)) || pos.y != float(firstUse[j] / (nGrid + 1)))
+                    {
+                        printf("ERROR: WaveFront OBJ grid vertex %zu is not in first-reference order\n", j);
+                        success = false;
+                        break;
+                    }
+                }
+
+                // Default (ccw) loads keep the source winding; cw loads swap the last two corners
+                DX::WaveFrontReader<uint16_t> flipped;
+                hr = flipped.Load(szPath, false);
+                if (FAILED(hr) || flipped.indices.size() != faces.size())
+                {
+                    printf("ERROR: WaveFront OBJ grid load [cw] failed (%08X)\n", static_cast<unsigned int>(hr));
+                    success = false;
+                }
+
+                for (size_t j = 0; j < faces.size(); j += 3)
+                {
+                    bool matches = true;
+                    for (size_t k = 0; k < 3; ++k)
+                    {
+                        const auto& pos = serial.vertices[serial.indices[j + k]].position;
+                        if (uint32_t(pos.y) * (nGrid + 1) + uint32_t(pos.x) != faces[j + k])
+                            matches = false;
+
+                        if (flipped.indices.size() == faces.size())
+                        {
+                            static const size_t s_cw[3] = { 0, 2, 1 };
+                            const auto& cwpos = flipped.vertices[flipped.indices[j + s_cw[k]]].position;
+                            if (uint32_t(cwpos.y) * (nGrid + 1) + uint32_t(cwpos.x) != faces[j + k])
+                                matches = false;
+                        }
+                    }
+
+                    if (!matches)
+                    {
+                        printf("ERROR: WaveFront OBJ grid face %zu does not match source winding\n", j / 3);
+                        success = false;
+                        break;
+                    }
+                }
+
+                constexpr size_t nThreads = 4;
+                std::unique_ptr<DX::WaveFrontReader<uint16_t>[]> readers(new DX::WaveFrontReader<uint16_t>[nThreads]);
+                HRESULT results[nThreads] = {};
+
+                std::vector<std::thread> threads;
+                threads.reserve(nThreads);
+                for (size_t t = 0; t < nThreads; ++t)
+                {
+                    threads.emplace_back([&, t]() { results[t] = readers[t].Load(szPath); });
+                }
+
+                for (auto& it : threads)
+                {
+                    it.join();
+                }
+
+                for (size_t t = 0; t < nThreads; ++t)
+                {
+                    if (FAILED(results[t]))
+                    {
+                        printf("ERROR: WaveFront OBJ concurrent grid load %zu failed (%08X)\n", t, static_cast<unsigned int>(results[t]));
+                        success = false;
+                    }
+                    else if (!IsSameMesh(serial, readers[t]))
+                    {
+                        printf("ERROR: WaveFront OBJ concurrent grid load %zu differs from serial load\n", t);
+                        success = false;
+                    }
+                }
+            }
+
+            std::ignore = DeleteFileW(szPath);
+        }
+    }
+
+    // 16-bit loads must fail cleanly once the unique vertex count exceeds the index range
+    {
+        struct GridTest
+        {
+            uint32_t nGrid;
+            bool fits16;
+        };
+
+        static const GridTest s_grids[] =
+        {
+            { 254, true },  // 65025 vertices
+            { 256, false }, // 66049 vertices
+        };
+
+        for (size_t j = 0; j < std::size(s_grids); ++j)
+        {
+            const uint32_t nGrid = s_grids[j].nGrid;
+            const size_t nVerts = size_t(nGrid + 1) * size_t(nGrid + 1);
+
+            std::string text = CreateGridOBJ(nGrid);
+
+            wchar_t szPath[MAX_PATH] = {};
+            if (!WriteTempFile(text.c_str(), szPath))
+            {
+                printf("ERROR: Failed writing WaveFront OBJ temp file\n");
+                success = false;
+                continue;
+            }
+
+            DX::WaveFrontReader<uint32_t> wfReader32;
+            HRESULT hr = wfReader32.Load(szPath);
+            if (FAILED(hr))
+            {
+                printf("ERROR: WaveFront OBJ 32-bit grid %u load failed (%08X)\n", nGrid, static_cast<unsigned int>(hr));
+                success = false;
+            }
+            else if (wfReader32.vertices.size() != nVerts || wfReader32.indices.size() != size_t(nGrid) * nGrid * 6)
+            {
+                printf("ERROR: WaveFront OBJ 32-bit grid %u: verts %zu .. %zu, inds %zu\n", nGrid, wfReader32.vertices.size(), nVerts, wfReader32.indices.size());
+                success = false;
+            }
+
+            DX::WaveFrontReader<uint16_t> wfReader16;
+            hr = wfReader16.Load(szPath);
+            if (!s_grids[j].fits16)
+            {
+                if (SUCCEEDED(hr))
+                {
+                    printf("ERROR: WaveFront OBJ 16-bit grid %u should have failed (%zu vertices)\n", nGrid, nVerts);
+                    success = false;
+                }
+            }
+            else if (FAILED(hr))
+            {
+                printf("ERROR: WaveFront OBJ 16-bit grid %u load failed (%08X)\n", nGrid, static_cast<unsigned int>(hr));
+                success = false;
+            }
+            else if (wfReader16.vertices.size() != wfReader32.vertices.size()
+                || wfReader16.indices.size() != wfReader32.indices.size()
+                || !std::equal(wfReader16.indices.cbegin(), wfReader16.indices.cend(), wfReader32.indices.cbegin(),
+                    [](uint16_t a, uint32_t b) { return a == b; })
+                || memcmp(wfReader16.vertices.data(), wfReader32.vertices.data(), sizeof(DX::WaveFrontReader<uint16_t>::Vertex) * wfReader16.vertices.size()) != 0)
+            {
+                printf("ERROR: WaveFront OBJ 16-bit grid %u does not match 32-bit load\n", nGrid);
+                success = false;
+            }
+
+            std::ignore = DeleteFileW(szPath);
+        }
+    }
+
+    // parsed geometry written in the VBO layout must load back bit-for-bit
+    {
+        std::string text = CreateGridOBJ(64);
+
+        wchar_t szPath[MAX_PATH] = {};
+        DX::WaveFrontReader<uint16_t> parsed;
+
+        HRESULT hr = E_FAIL;
+        if (WriteTempFile(text.c_str(), szPath))
+        {
+            hr = parsed.Load(szPath);
+            std::ignore = DeleteFileW(szPath);
+        }
+
+        if (FAILED(hr))
+        {
+            printf("ERROR: WaveFront OBJ grid load for VBO round trip failed (%08X)\n", static_cast<unsigned int>(hr));
+            success = false;
+        }
+        else
+        {
+            const uint32_t header[2] = { static_cast<uint32_t>(parsed.vertices.size()), static_cast<uint32_t>(parsed.indices.size()) };
+
+            std::string blob(reinterpret_cast<const char*>(header), sizeof(header));
+            blob.append(reinterpret_cast<const char*>(parsed.vertices.data()), sizeof(DX::WaveFrontReader<uint16_t>::Vertex) * parsed.vertices.size());
+            blob.append(reinterpret_cast<const char*>(parsed.indices.data()), sizeof(uint16_t) * parsed.indices.size());
+
+            wchar_t tempPath[MAX_PATH] = {};
+            hr = E_FAIL;
+            if (GetTempPathW(MAX_PATH, tempPath) && GetTempFileNameW(tempPath, L"vbo", 0, szPath))
+            {
+                std::ofstream outFile(szPath, std::ios::out | std::ios::binary | std::ios::trunc);
+                outFile.write(blob.data(), static_cast<std::streamsize>(blob.size()));
+                outFile.close();
+
+                if (!outFile.fail())
+                {
+                    DX::WaveFrontReader<uint16_t> cached;
+                    hr = cached.LoadVBO(szPath);
+                    if (SUCCEEDED(hr)
+                        && (cached.vertices.size() != parsed.vertices.size()
+                            || cached.indices != parsed.indices
+                            || memcmp(cached.vertices.data(), parsed.vertices.data(), sizeof(DX::WaveFrontReader<uint16_t>::Vertex) * parsed.vertices.size()) != 0))
+                    {
+                        printf("ERROR: WaveFront VBO round trip does not match parsed OBJ\n");
+                        success = false;
+                    }
+                }
+
+                std::ignore = DeleteFileW(szPath);
+            }
+
+            if (FAILED(hr))
+            {
+                printf("ERROR: WaveFront VBO round trip load failed (%08X)\n", static_cast<unsigned int>(hr));
+                success = false;
+            }
+        }
+    }
+
     // invalid args
     {
         DX::WaveFrontReader<uint16_t> wfReader;
@@ -316,6 +316,60 @@ bool Test02_DX12()
         }
     }
 
+    // Every slot's stride must match, with unused slots left at zero
+    {
+        struct SlotDesc
+        {
+            const char* name;
+            size_t elements;
+            const D3D12_INPUT_ELEMENT_DESC* desc;
+            uint32_t strides[2];
+            uint32_t offsets[8];
+        };
+
+        const SlotDesc layouts[] =
+        {
+            { "VertexPositionColor", 2, g_VertexPositionColor, { 28, 0 }, { 0, 12 } },
+            { "VertexPositionNormalTangentColorTextureSkinning", 7, g_VertexPositionNormalTangentColorTextureSkinning, { 60, 0 }, { 0, 12, 24, 40, 44, 52, 56 } },
+            { "quadLayout", 2, g_quadlayout, { 24, 0 }, { 0, 16 } },
+            { "alignedElements", 4, s_alignedElements, { 18, 0 }, { 0, 2, 14, 16 } },
+            { "unusualSize", 4, s_unusualSize, { 16, 0 }, { 0, 12, 13, 14 } },
+            { "VSStarterKitAnimation", 7, g_VSStarterKitAnimation, { 52, 20 }, { 0, 12, 24, 40, 44, 0, 4 } },
+            { "instlayout", 7, s_instlayout, { 32, 64 }, { 0, 12, 24, 0, 16, 32, 48 } },
+            { "leaflayout", 7, s_leaflayout, { 20, 68 }, { 0, 12, 0, 16, 32, 48, 64 } },
+            { "leaflayoutMixed", 7, s_leaflayoutMixed, { 20, 68 }, { 0, 0, 16, 32, 12, 48, 64 } },
+        };
+
+        for (size_t j = 0; j < std::size(layouts); ++j)
+        {
+            const D3D12_INPUT_LAYOUT_DESC desc = { layouts[j].desc, static_cast<UINT>(layouts[j].elements) };
+
+            uint32_t offsets[D3D12_IA_VERTEX_INPUT_STRUCTURE_ELEMENT_COUNT];
+            memset(offsets, 0xff, sizeof(offsets));
+
+            uint32_t strides[D3D12_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT];
+            memset(strides, 0xff, sizeof(strides));
+
+            ComputeInputLayout(desc, offsets, strides);
+
+            if (memcmp(offsets, layouts[j].offsets, sizeof(uint32_t) * layouts[j].elements) != 0)
+            {
+                printe("ERROR: ComputeInputLayout offsets failed for desc %s\n", layouts[j].name);
+                success = false;
+            }
+
+            for (size_t k = 0; k < std::size(strides); ++k)
+            {
+                const uint32_t expected = (k < std::size(layouts[j].strides)) ? layouts[j].strides[k] : 0;
+                if (strides[k] != expected)
+                {
+                    printe("ERROR: ComputeInputLayout slot %zu stride for desc %s is %u (expected %u)\n", k, layouts[j].name, strides[k], expected);
+                    success = false;
+                }
+            }
+        }
+    }
+
     // Multi-stream
     {
         uint32_t offsets[ D3D12_IA_VERTEX_INPUT_STRUCTURE_ELEMENT_COUNT ];
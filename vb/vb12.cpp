@@ -12,6 +12,11 @@
 #include <d3d12.h>
 #endif
 
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "DirectXMesh.h"
 
 #include "DirectXMeshP.h"
@@ -24,6 +29,8 @@
 using namespace DirectX;
 using namespace TestInputLayouts12;
 
+extern const wchar_t* GetName( DXGI_FORMAT fmt );
+
 namespace
 {
 
@@ -174,6 +181,45 @@ namespace
 
     //-----------------------------------------------------------------------------------
 
+    struct CompressedVertex
+    {
+        uint16_t position[4];
+        uint32_t normal;
+        uint32_t color;
+        uint16_t textureCoordinate[2];
+    };
+
+    static_assert(sizeof(CompressedVertex) == 20, "Mismatch with compressed layout");
+
+    const D3D12_INPUT_ELEMENT_DESC s_compressedIL[] =
+    {
+        { "POSITION", 0, DXGI_FORMAT_R16G16B16A16_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "NORMAL", 0, DXGI_FORMAT_R10G10B10A2_UNORM, 0, 8, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "COLOR", 0, DXGI_FORMAT_B8G8R8A8_UNORM, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, 0, 16, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+    };
+
+    //-----------------------------------------------------------------------------------
+
+    // Twelve elements split across two interleaved streams
+    const D3D12_INPUT_ELEMENT_DESC s_wideIL[] =
+    {
+        { "POSITION",     0, DXGI_FORMAT_R32G32B32_FLOAT,    0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "NORMAL",       0, DXGI_FORMAT_R10G10B10A2_UNORM,  0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "TANGENT",      0, DXGI_FORMAT_R16G16B16A16_SNORM, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "BINORMAL",     0, DXGI_FORMAT_R8G8B8A8_SNORM,     0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "COLOR",        0, DXGI_FORMAT_B8G8R8A8_UNORM,     0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "COLOR",        1, DXGI_FORMAT_R8G8B8A8_UNORM,     0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "TEXCOORD",     0, DXGI_FORMAT_R16G16_FLOAT,       1, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "TEXCOORD",     1, DXGI_FORMAT_R32G32_FLOAT,       1, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "TEXCOORD",     2, DXGI_FORMAT_R16G16_UNORM,       1, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "BLENDINDICES", 0, DXGI_FORMAT_R8G8B8A8_UINT,      1, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "BLENDWEIGHT",  0, DXGI_FORMAT_R8G8B8A8_UNORM,     1, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "PSIZE",        0, DXGI_FORMAT_R32_FLOAT,          1, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+    };
+
+    //-----------------------------------------------------------------------------------
+
     struct TestVB
     {
         DXGI_FORMAT         format;
@@ -661,11 +707,189 @@ namespace
         { g_layout, std::size(g_layout), sizeof(Vertex), MEDIA_PATH L"torus.vbo" },
     #endif
     };
-}
 
-//-------------------------------------------------------------------------------------
+    // Reads a buffer cycling through every test value of each format so that multi-vertex decode paths and their tails are covered
+    bool TestReadFormatRuns(_In_reads_(count) const TestVB* tests, size_t count, bool x2bias)
+    {
+        constexpr size_t nVerts = 67;
 
-extern const wchar_t* GetName( DXGI_FORMAT fmt );
+        bool success = true;
+
+        auto temp = make_AlignedArrayXMVECTOR(nVerts);
+
+        for (size_t start = 0; start < count; )
+        {
+            const DXGI_FORMAT format = tests[start].format;
+
+            size_t end = start + 1;
+            while (end < count && tests[end].format == format)
+                ++end;
+
+            const size_t nvalues = end - start;
+
+            for (size_t pad = 0; pad <= 4; pad += 4)
+            {
+                const size_t stride = tests[start].stride + pad;
+
+                auto vb = CreateVertexBuffer(stride, nVerts);
+                for (size_t j = 0; j < nVerts; ++j)
+                {
+                    memcpy(vb.get() + j * stride, &tests[start + (j % nvalues)].bytes[0], tests[start].stride);
+                }
+
+                auto reader = std::make_unique<VBReader>();
+
+                D3D12_INPUT_ELEMENT_DESC ilDesc = { "DATA", 0, format, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 };
+
+                D3D12_INPUT_LAYOUT_DESC desc = { &ilDesc, 1 };
+
+                HRESULT hr = reader->Initialize(desc);
+                if (FAILED(hr))
+                {
+                    success = false;
+                    printe("ERROR: Failed setting up VB reader for format %ls (x2bias %d), stride %zu (%08X)\n", GetName(format), x2bias, stride, static_cast<unsigned int>(hr));
+                    continue;
+                }
+
+                hr = reader->AddStream(vb.get(), nVerts, 0, stride);
+                if (FAILED(hr))
+                {
+                    success = false;
+                    printe("ERROR: Failed setting up stream for VB reader for format %ls (x2bias %d), stride %zu (%08X)\n", GetName(format), x2bias, stride, static_cast<unsigned int>(hr));
+                    continue;
+                }
+
+                memset(temp.get(), 0xff, sizeof(XMVECTOR) * nVerts);
+
+                hr = reader->Read(temp.get(), "DATA", 0, nVerts, x2bias);
+                if (FAILED(hr))
+                {
+                    success = false;
+                    printe("ERROR: Failed reading VB format %ls (x2bias %d), stride %zu (%08X)\n", GetName(format), x2bias, stride, static_cast<unsigned int>(hr));
+                    continue;
+                }
+
+                for (size_t j = 0; j < nVerts; ++j)
+                {
+                    auto& v = tests[start + (j % nvalues)];
+
+                    XMVECTOR chk = XMLoadFloat4(&v.vector);
+
+                    if (!XMVector4NearEqual(chk, temp[j], g_VBEpsilon))
+                    {
+                        success = false;
+                        printe("ERROR: Failed reading VB format %ls (x2bias %d), stride %zu, vertex %zu: %f %f %f %f ... %f %f %f %f\n", GetName(format), x2bias, stride, j,
+                            XMVectorGetX(temp[j]), XMVectorGetY(temp[j]), XMVectorGetZ(temp[j]), XMVectorGetW(temp[j]),
+                            v.vector.x, v.vector.y, v.vector.z, v.vector.w);
+                        break;
+                    }
+                }
+            }
+
+            start = end;
+        }
+
+        return success;
+    }
+
+    // Writes a buffer cycling through every test value of each format so that multi-vertex encode paths and their tails are covered
+    bool TestWriteFormatRuns(_In_reads_(count) const TestVB* tests, size_t count, bool x2bias)
+    {
+        constexpr size_t nVerts = 67;
+        constexpr uint8_t c_fill = 0xCD;
+
+        bool success = true;
+
+        auto temp = make_AlignedArrayXMVECTOR(nVerts);
+
+        for (size_t start = 0; start < count; )
+        {
+            const DXGI_FORMAT format = tests[start].format;
+
+            size_t end = start + 1;
+            while (end < count && tests[end].format == format)
+                ++end;
+
+            const size_t nvalues = end - start;
+
+            for (size_t j = 0; j < nVerts; ++j)
+            {
+                temp[j] = XMLoadFloat4(&tests[start + (j % nvalues)].vector);
+            }
+
+            for (size_t pad = 0; pad <= 4; pad += 4)
+            {
+                const size_t elementSize = tests[start].stride;
+                const size_t stride = elementSize + pad;
+
+                auto vb = CreateVertexBuffer(stride, nVerts);
+                memset(vb.get(), c_fill, stride * nVerts);
+
+                auto writer = std::make_unique<VBWriter>();
+
+                D3D12_INPUT_ELEMENT_DESC ilDesc = { "DATA", 0, format, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 };
+
+                D3D12_INPUT_LAYOUT_DESC desc = { &ilDesc, 1 };
+
+                HRESULT hr = writer->Initialize(desc);
+                if (FAILED(hr))
+                {
+                    success = false;
+                    printe("ERROR: Failed setting up VB writer for format %ls (x2bias %d), stride %zu (%08X)\n", GetName(format), x2bias, stride, static_cast<unsigned int>(hr));
+                    continue;
+                }
+
+                hr = writer->AddStream(vb.get(), nVerts, 0, stride);
+                if (FAILED(hr))
+                {
+                    success = false;
+                    printe("ERROR: Failed setting up stream for VB writer for format %ls (x2bias %d), stride %zu (%08X)\n", GetName(format), x2bias, stride, static_cast<unsigned int>(hr));
+                    continue;
+                }
+
+                hr = writer->Write(temp.get(), "DATA", 0, nVerts, x2bias);
+                if (FAILED(hr))
+                {
+                    success = false;
+                    printe("ERROR: Failed writing VB format %ls (x2bias %d), stride %zu (%08X)\n", GetName(format), x2bias, stride, static_cast<unsigned int>(hr));
+                    continue;
+                }
+
+                for (size_t j = 0; j < nVerts; ++j)
+                {
+                    auto& v = tests[start + (j % nvalues)];
+
+                    const uint8_t* ptr = vb.get() + j * stride;
+
+                    bool padok = true;
+                    for (size_t k = elementSize; k < stride; ++k)
+                    {
+                        if (ptr[k] != c_fill)
+                            padok = false;
+                    }
+
+                    if (memcmp(ptr, &v.bytes[0], elementSize) != 0)
+                    {
+                        success = false;
+                        printe("ERROR: Failed writing VB format %ls (x2bias %d), stride %zu, vertex %zu: %f %f %f %f\n", GetName(format), x2bias, stride, j,
+                            v.vector.x, v.vector.y, v.vector.z, v.vector.w);
+                        break;
+                    }
+                    else if (!padok)
+                    {
+                        success = false;
+                        printe("ERROR: Failed writing VB format %ls (x2bias %d), stride %zu, vertex %zu overwrote padding\n", GetName(format), x2bias, stride, j);
+                        break;
+                    }
+                }
+            }
+
+            start = end;
+        }
+
+        return success;
+    }
+}
 
 //-------------------------------------------------------------------------------------
 // VBReader
@@ -1123,6 +1347,207 @@ bool Test03_DX12()
         }
     }
 
+    // Wide layout (per-element reads must not depend on read order)
+    {
+        constexpr size_t nVerts = 257;
+        constexpr size_t nElements = std::size(s_wideIL);
+
+        uint32_t offsets[nElements] = {};
+        uint32_t strides[D3D12_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT] = {};
+        const D3D12_INPUT_LAYOUT_DESC desc = { s_wideIL, static_cast<UINT>(nElements) };
+        ComputeInputLayout(desc, offsets, strides);
+
+        auto vb0 = CreateVertexBuffer(strides[0], nVerts);
+        auto vb1 = CreateVertexBuffer(strides[1], nVerts);
+
+        uint32_t seed = 0x1234567u;
+        for (size_t j = 0; j < strides[0] * nVerts; ++j)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            vb0[j] = static_cast<uint8_t>(seed >> 24);
+        }
+        for (size_t j = 0; j < strides[1] * nVerts; ++j)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            vb1[j] = static_cast<uint8_t>(seed >> 24);
+        }
+
+        auto reader = std::make_unique<VBReader>();
+
+        HRESULT hr = reader->Initialize(desc);
+        if (SUCCEEDED(hr))
+            hr = reader->AddStream(vb0.get(), nVerts, 0, strides[0]);
+        if (SUCCEEDED(hr))
+            hr = reader->AddStream(vb1.get(), nVerts, 1, strides[1]);
+
+        if (FAILED(hr))
+        {
+            success = false;
+            printe("ERROR: Failed setting up wide layout VB reader (%08X)\n", static_cast<unsigned int>(hr));
+        }
+        else
+        {
+            // Reference results come from isolated single-element readers
+            auto expected = make_AlignedArrayXMVECTOR(nVerts * nElements);
+            memset(expected.get(), 0, sizeof(XMVECTOR) * nVerts * nElements);
+
+            for (size_t e = 0; e < nElements; ++e)
+            {
+                D3D12_INPUT_ELEMENT_DESC ilDesc = s_wideIL[e];
+                ilDesc.InputSlot = 0;
+                ilDesc.AlignedByteOffset = 0;
+
+                const uint32_t slot = s_wideIL[e].InputSlot;
+                const uint8_t* base = ((slot) ? vb1.get() : vb0.get()) + offsets[e];
+
+                auto single = std::make_unique<VBReader>();
+                const D3D12_INPUT_LAYOUT_DESC singleDesc = { &ilDesc, 1 };
+                hr = single->Initialize(singleDesc);
+                if (SUCCEEDED(hr))
+                    hr = single->AddStream(base, nVerts, 0, strides[slot]);
+                if (SUCCEEDED(hr))
+                    hr = single->Read(expected.get() + e * nVerts, ilDesc.SemanticName, ilDesc.SemanticIndex, nVerts);
+
+                if (FAILED(hr))
+                {
+                    success = false;
+                    printe("ERROR: Failed reading single-element VB %s%u (%08X)\n", ilDesc.SemanticName, ilDesc.SemanticIndex, static_cast<unsigned int>(hr));
+                }
+            }
+
+            auto temp = make_AlignedArrayXMVECTOR(nVerts);
+
+            // Forward, reverse, then alternating between the two streams
+            for (size_t pass = 0; pass < 3; ++pass)
+            {
+                for (size_t k = 0; k < nElements; ++k)
+                {
+                    size_t e = k;
+                    if (pass == 1)
+                        e = nElements - 1 - k;
+                    else if (pass == 2)
+                        e = (k & 1) ? (nElements / 2 + k / 2) : (k / 2);
+
+                    memset(temp.get(), 0xff, sizeof(XMVECTOR) * nVerts);
+
+                    hr = reader->Read(temp.get(), s_wideIL[e].SemanticName, s_wideIL[e].SemanticIndex, nVerts);
+                    if (FAILED(hr))
+                    {
+                        success = false;
+                        printe("ERROR: Failed reading wide layout VB %s%u, pass %zu (%08X)\n", s_wideIL[e].SemanticName, s_wideIL[e].SemanticIndex, pass, static_cast<unsigned int>(hr));
+                    }
+                    else if (memcmp(temp.get(), expected.get() + e * nVerts, sizeof(XMVECTOR) * nVerts) != 0)
+                    {
+                        success = false;
+                        printe("ERROR: Wide layout VB %s%u differs from single-element read, pass %zu\n", s_wideIL[e].SemanticName, s_wideIL[e].SemanticIndex, pass);
+                    }
+                }
+            }
+        }
+    }
+
+    // Re-initialization across layouts that differ only in content, not shape
+    {
+        constexpr size_t nVerts = 64;
+        constexpr size_t nElements = std::size(s_compressedIL);
+        constexpr size_t nLayouts = 3;
+
+        // Same shape as the compressed layout but COLOR is not swizzled
+        D3D12_INPUT_ELEMENT_DESC rgbaColorIL[nElements];
+        memcpy(rgbaColorIL, s_compressedIL, sizeof(s_compressedIL));
+        rgbaColorIL[2].Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+
+        // Same content at a different address with its own semantic strings
+        std::string names[nElements];
+        D3D12_INPUT_ELEMENT_DESC copyIL[nElements];
+        memcpy(copyIL, s_compressedIL, sizeof(s_compressedIL));
+        for (size_t j = 0; j < nElements; ++j)
+        {
+            names[j] = s_compressedIL[j].SemanticName;
+            copyIL[j].SemanticName = names[j].c_str();
+        }
+
+        const D3D12_INPUT_ELEMENT_DESC* layouts[nLayouts] = { s_compressedIL, rgbaColorIL, copyIL };
+
+        auto vb = CreateVertexBuffer(sizeof(CompressedVertex), nVerts);
+        uint32_t seed = 0x9E3779B9u;
+        for (size_t j = 0; j < sizeof(CompressedVertex) * nVerts; ++j)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            vb[j] = static_cast<uint8_t>(seed >> 24);
+        }
+
+        // Reference results from a fresh reader per layout
+        auto expected = make_AlignedArrayXMVECTOR(nVerts * nElements * nLayouts);
+        memset(expected.get(), 0, sizeof(XMVECTOR) * nVerts * nElements * nLayouts);
+
+        for (size_t l = 0; l < nLayouts; ++l)
+        {
+            auto fresh = std::make_unique<VBReader>();
+
+            const D3D12_INPUT_LAYOUT_DESC desc = { layouts[l], static_cast<UINT>(nElements) };
+
+            HRESULT hr = fresh->Initialize(desc);
+            if (SUCCEEDED(hr))
+                hr = fresh->AddStream(vb.get(), nVerts, 0, sizeof(CompressedVertex));
+
+            for (size_t j = 0; SUCCEEDED(hr) && j < nElements; ++j)
+            {
+                hr = fresh->Read(expected.get() + (l * nElements + j) * nVerts, layouts[l][j].SemanticName, layouts[l][j].SemanticIndex, nVerts);
+            }
+
+            if (FAILED(hr))
+            {
+                success = false;
+                printe("ERROR: Failed reading VB with fresh reader, layout %zu (%08X)\n", l, static_cast<unsigned int>(hr));
+            }
+        }
+
+        if (!memcmp(expected.get() + 2 * nVerts, expected.get() + (nElements + 2) * nVerts, sizeof(XMVECTOR) * nVerts))
+        {
+            success = false;
+            printe("ERROR: Expected COLOR swizzle to differ between layouts\n");
+        }
+
+        auto reader = std::make_unique<VBReader>();
+        auto temp = make_AlignedArrayXMVECTOR(nVerts);
+
+        for (size_t pass = 0; pass < nLayouts * 3; ++pass)
+        {
+            const size_t l = (pass * 2) % nLayouts;
+
+            const D3D12_INPUT_LAYOUT_DESC desc = { layouts[l], static_cast<UINT>(nElements) };
+
+            HRESULT hr = reader->Initialize(desc);
+            if (SUCCEEDED(hr))
+                hr = reader->AddStream(vb.get(), nVerts, 0, sizeof(CompressedVertex));
+
+            if (FAILED(hr))
+            {
+                success = false;
+                printe("ERROR: Failed re-initializing VB reader, layout %zu, pass %zu (%08X)\n", l, pass, static_cast<unsigned int>(hr));
+                continue;
+            }
+
+            for (size_t j = 0; j < nElements; ++j)
+            {
+                memset(temp.get(), 0xff, sizeof(XMVECTOR) * nVerts);
+
+                hr = reader->Read(temp.get(), layouts[l][j].SemanticName, layouts[l][j].SemanticIndex, nVerts);
+                if (FAILED(hr))
+                {
+                    success = false;
+                    printe("ERROR: Failed reading VB %s after re-initialize, layout %zu, pass %zu (%08X)\n", layouts[l][j].SemanticName, l, pass, static_cast<unsigned int>(hr));
+                }
+                else if (memcmp(temp.get(), expected.get() + (l * nElements + j) * nVerts, sizeof(XMVECTOR) * nVerts) != 0)
+                {
+                    success = false;
+                    printe("ERROR: VB %s after re-initialize differs from fresh reader, layout %zu, pass %zu\n", layouts[l][j].SemanticName, l, pass);
+                }
+            }
+        }
+    }
+
     // Instancing (not supported)
     {
         auto reader = std::make_unique<VBReader>();
@@ -1653,6 +2078,100 @@ bool Test04_DX12()
         }
     }
 
+    // Re-initialization across layouts that differ only in content, not shape
+    {
+        constexpr size_t nVerts = 64;
+        constexpr size_t nElements = std::size(s_compressedIL);
+        constexpr size_t nLayouts = 3;
+
+        // Same shape as the compressed layout but COLOR is not swizzled
+        D3D12_INPUT_ELEMENT_DESC rgbaColorIL[nElements];
+        memcpy(rgbaColorIL, s_compressedIL, sizeof(s_compressedIL));
+        rgbaColorIL[2].Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+
+        // Same content at a different address with its own semantic strings
+        std::string names[nElements];
+        D3D12_INPUT_ELEMENT_DESC copyIL[nElements];
+        memcpy(copyIL, s_compressedIL, sizeof(s_compressedIL));
+        for (size_t j = 0; j < nElements; ++j)
+        {
+            names[j] = s_compressedIL[j].SemanticName;
+            copyIL[j].SemanticName = names[j].c_str();
+        }
+
+        const D3D12_INPUT_ELEMENT_DESC* layouts[nLayouts] = { s_compressedIL, rgbaColorIL, copyIL };
+
+        auto data = make_AlignedArrayXMVECTOR(nVerts);
+        for (size_t j = 0; j < nVerts; ++j)
+        {
+            const float t = float(j) / float(nVerts);
+            data[j] = XMVectorSet(t, 1.f - t, 0.25f + t * 0.5f, (j & 1) ? 1.f : 0.f);
+        }
+
+        // Reference results from a fresh writer per layout
+        auto expected = CreateVertexBuffer(sizeof(CompressedVertex), nVerts * nLayouts);
+
+        for (size_t l = 0; l < nLayouts; ++l)
+        {
+            auto fresh = std::make_unique<VBWriter>();
+
+            const D3D12_INPUT_LAYOUT_DESC desc = { layouts[l], static_cast<UINT>(nElements) };
+
+            HRESULT hr = fresh->Initialize(desc);
+            if (SUCCEEDED(hr))
+                hr = fresh->AddStream(expected.get() + l * nVerts * sizeof(CompressedVertex), nVerts, 0, sizeof(CompressedVertex));
+
+            for (size_t j = 0; SUCCEEDED(hr) && j < nElements; ++j)
+            {
+                hr = fresh->Write(data.get(), layouts[l][j].SemanticName, layouts[l][j].SemanticIndex, nVerts);
+            }
+
+            if (FAILED(hr))
+            {
+                success = false;
+                printe("ERROR: Failed writing VB with fresh writer, layout %zu (%08X)\n", l, static_cast<unsigned int>(hr));
+            }
+        }
+
+        if (!memcmp(expected.get(), expected.get() + nVerts * sizeof(CompressedVertex), nVerts * sizeof(CompressedVertex)))
+        {
+            success = false;
+            printe("ERROR: Expected COLOR swizzle to differ between layouts\n");
+        }
+
+        auto writer = std::make_unique<VBWriter>();
+        auto vb = CreateVertexBuffer(sizeof(CompressedVertex), nVerts);
+
+        for (size_t pass = 0; pass < nLayouts * 3; ++pass)
+        {
+            const size_t l = (pass * 2) % nLayouts;
+
+            memset(vb.get(), 0, sizeof(CompressedVertex) * nVerts);
+
+            const D3D12_INPUT_LAYOUT_DESC desc = { layouts[l], static_cast<UINT>(nElements) };
+
+            HRESULT hr = writer->Initialize(desc);
+            if (SUCCEEDED(hr))
+                hr = writer->AddStream(vb.get(), nVerts, 0, sizeof(CompressedVertex));
+
+            for (size_t j = 0; SUCCEEDED(hr) && j < nElements; ++j)
+            {
+                hr = writer->Write(data.get(), layouts[l][j].SemanticName, layouts[l][j].SemanticIndex, nVerts);
+            }
+
+            if (FAILED(hr))
+            {
+                success = false;
+                printe("ERROR: Failed writing VB after re-initialize, layout %zu, pass %zu (%08X)\n", l, pass, static_cast<unsigned int>(hr));
+            }
+            else if (memcmp(vb.get(), expected.get() + l * nVerts * sizeof(CompressedVertex), sizeof(CompressedVertex) * nVerts) != 0)
+            {
+                success = false;
+                printe("ERROR: VB after re-initialize differs from fresh writer, layout %zu, pass %zu\n", l, pass);
+            }
+        }
+    }
+
     // invalid args
     #pragma warning(push)
     #pragma warning(disable:6385 6387)
@@ -1908,6 +2427,13 @@ bool Test05_DX12()
         }
     }
 
+    // Multi-vertex reads
+    if (!TestReadFormatRuns(g_TestVBs, std::size(g_TestVBs), false))
+        success = false;
+
+    if (!TestReadFormatRuns(g_TestVBs_x2Bias, std::size(g_TestVBs_x2Bias), true))
+        success = false;
+
     return success;
 }
 
@@ -2046,6 +2572,13 @@ bool Test06_DX12()
         }
     }
 
+    // Multi-vertex writes
+    if (!TestWriteFormatRuns(g_TestVBs, std::size(g_TestVBs), false))
+        success = false;
+
+    if (!TestWriteFormatRuns(g_TestVBs_x2Bias, std::size(g_TestVBs_x2Bias), true))
+        success = false;
+
     return success;
 }
 
@@ -2173,6 +2706,297 @@ bool Test07_DX12()
         }
     }
 
+    // Layout conversion (VS Starter Kit to compressed)
+    {
+        const size_t nVerts = std::size(s_VSStarterKitVB1);
+
+        auto reader = std::make_unique<VBReader>();
+        auto writer = std::make_unique<VBWriter>();
+
+        std::unique_ptr<CompressedVertex[]> vb(new CompressedVertex[nVerts]);
+        memset(vb.get(), 0, sizeof(CompressedVertex) * nVerts);
+
+        D3D12_INPUT_LAYOUT_DESC srcDesc = { g_VSStarterKit, static_cast<UINT>(std::size(g_VSStarterKit)) };
+        D3D12_INPUT_LAYOUT_DESC destDesc = { s_compressedIL, static_cast<UINT>(std::size(s_compressedIL)) };
+
+        HRESULT hr = reader->Initialize(srcDesc);
+        if (SUCCEEDED(hr))
+            hr = reader->AddStream(&s_VSStarterKitVB1, nVerts, 0, sizeof(VSStarterKitVertex1));
+        if (SUCCEEDED(hr))
+            hr = writer->Initialize(destDesc);
+        if (SUCCEEDED(hr))
+            hr = writer->AddStream(vb.get(), nVerts, 0, sizeof(CompressedVertex));
+
+        if (FAILED(hr))
+        {
+            success = false;
+            printe("ERROR: Failed setting up VB layout conversion (%08X)\n", static_cast<unsigned int>(hr));
+        }
+        else
+        {
+            auto temp = make_AlignedArrayXMVECTOR(nVerts);
+
+            for (size_t j = 0; j < std::size(s_compressedIL); ++j)
+            {
+                const bool x2bias = (s_compressedIL[j].Format == DXGI_FORMAT_R10G10B10A2_UNORM);
+
+                hr = reader->Read(temp.get(), s_compressedIL[j].SemanticName, s_compressedIL[j].SemanticIndex, nVerts);
+                if (SUCCEEDED(hr))
+                    hr = writer->Write(temp.get(), s_compressedIL[j].SemanticName, s_compressedIL[j].SemanticIndex, nVerts, x2bias);
+
+                if (FAILED(hr))
+                {
+                    success = false;
+                    printe("ERROR: Failed VB layout conversion of %s (%08X)\n", s_compressedIL[j].SemanticName, static_cast<unsigned int>(hr));
+                }
+            }
+
+            // Swizzling between 8-bit formats is exact
+            for (size_t j = 0; j < nVerts; ++j)
+            {
+                const uint32_t c = s_VSStarterKitVB1[j].color;
+                const uint32_t expected = (c & 0xFF00FF00) | ((c & 0xFF) << 16) | ((c >> 16) & 0xFF);
+                if (vb[j].color != expected)
+                {
+                    success = false;
+                    printe("ERROR: Failed VB layout conversion of COLOR, vertex %zu: %08X ... %08X\n", j, vb[j].color, expected);
+                    break;
+                }
+            }
+
+            // Remaining elements must read back within format precision
+            auto check = std::make_unique<VBReader>();
+            hr = check->Initialize(destDesc);
+            if (SUCCEEDED(hr))
+                hr = check->AddStream(vb.get(), nVerts, 0, sizeof(CompressedVertex));
+
+            if (FAILED(hr))
+            {
+                success = false;
+                printe("ERROR: Failed setting up VB reader for converted layout (%08X)\n", static_cast<unsigned int>(hr));
+            }
+            else
+            {
+                hr = check->Read(temp.get(), "POSITION", 0, nVerts);
+                if (FAILED(hr))
+                {
+                    success = false;
+                    printe("ERROR: Failed reading converted VB POSITION (%08X)\n", static_cast<unsigned int>(hr));
+                }
+                else
+                {
+                    for (size_t j = 0; j < nVerts; ++j)
+                    {
+                        if (!XMVector3NearEqual(XMLoadFloat3(&s_VSStarterKitVB1[j].position), temp[j], g_VBEpsilon))
+                        {
+                            success = false;
+                            printe("ERROR: Failed VB layout conversion of POSITION, vertex %zu\n", j);
+                            break;
+                        }
+                    }
+                }
+
+                hr = check->Read(temp.get(), "NORMAL", 0, nVerts, true);
+                if (FAILED(hr))
+                {
+                    success = false;
+                    printe("ERROR: Failed reading converted VB NORMAL (%08X)\n", static_cast<unsigned int>(hr));
+                }
+                else
+                {
+                    for (size_t j = 0; j < nVerts; ++j)
+                    {
+                        if (!XMVector3NearEqual(XMLoadFloat3(&s_VSStarterKitVB1[j].normal), temp[j], g_VBEpsilon))
+                        {
+                            success = false;
+                            printe("ERROR: Failed VB layout conversion of NORMAL, vertex %zu\n", j);
+                            break;
+                        }
+                    }
+                }
+
+                hr = check->Read(temp.get(), "TEXCOORD", 0, nVerts);
+                if (FAILED(hr))
+                {
+                    success = false;
+                    printe("ERROR: Failed reading converted VB TEXCOORD (%08X)\n", static_cast<unsigned int>(hr));
+                }
+                else
+                {
+                    for (size_t j = 0; j < nVerts; ++j)
+                    {
+                        if (!XMVector2NearEqual(XMLoadFloat2(&s_VSStarterKitVB1[j].texureCoordinate), temp[j], g_VBEpsilon))
+                        {
+                            success = false;
+                            printe("ERROR: Failed VB layout conversion of TEXCOORD, vertex %zu\n", j);
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Chunked layout conversion (bounded staging must match whole-buffer conversion)
+    {
+        constexpr size_t nVerts = 1031;
+
+        std::unique_ptr<VSStarterKitVertex1[]> src(new VSStarterKitVertex1[nVerts]);
+        for (size_t j = 0; j < nVerts; ++j)
+        {
+            const float t = float(j) / float(nVerts);
+            src[j].position = XMFLOAT3(t * 2.f - 1.f, sinf(t * 31.f), cosf(t * 17.f));
+            XMStoreFloat3(&src[j].normal, XMVector3Normalize(XMVectorSet(sinf(t * 7.f), cosf(t * 11.f), 0.5f, 0.f)));
+            src[j].tangent = XMFLOAT4(1.f, 0.f, 0.f, 1.f);
+            src[j].color = static_cast<uint32_t>(j * 2654435761u);
+            src[j].texureCoordinate = XMFLOAT2(t, 1.f - t);
+        }
+
+        auto reader = std::make_unique<VBReader>();
+        auto writer = std::make_unique<VBWriter>();
+
+        D3D12_INPUT_LAYOUT_DESC srcDesc = { g_VSStarterKit, static_cast<UINT>(std::size(g_VSStarterKit)) };
+        D3D12_INPUT_LAYOUT_DESC destDesc = { s_compressedIL, static_cast<UINT>(std::size(s_compressedIL)) };
+
+        HRESULT hr = reader->Initialize(srcDesc);
+        if (SUCCEEDED(hr))
+            hr = writer->Initialize(destDesc);
+
+        if (FAILED(hr))
+        {
+            success = false;
+            printe("ERROR: Failed setting up VB chunked conversion (%08X)\n", static_cast<unsigned int>(hr));
+        }
+        else
+        {
+            // Streams are rebound for each window so only 'chunk' vertices are staged at a time
+            auto convert = [&](CompressedVertex* dest, size_t chunk) -> HRESULT
+            {
+                auto temp = make_AlignedArrayXMVECTOR(chunk);
+
+                for (size_t first = 0; first < nVerts; first += chunk)
+                {
+                    const size_t count = std::min(chunk, nVerts - first);
+
+                    HRESULT result = reader->AddStream(src.get() + first, count, 0, sizeof(VSStarterKitVertex1));
+                    if (SUCCEEDED(result))
+                        result = writer->AddStream(dest + first, count, 0, sizeof(CompressedVertex));
+                    if (FAILED(result))
+                        return result;
+
+                    for (size_t j = 0; j < std::size(s_compressedIL); ++j)
+                    {
+                        const bool x2bias = (s_compressedIL[j].Format == DXGI_FORMAT_R10G10B10A2_UNORM);
+
+                        result = reader->Read(temp.get(), s_compressedIL[j].SemanticName, s_compressedIL[j].SemanticIndex, count);
+                        if (SUCCEEDED(result))
+                            result = writer->Write(temp.get(), s_compressedIL[j].SemanticName, s_compressedIL[j].SemanticIndex, count, x2bias);
+                        if (FAILED(result))
+                            return result;
+                    }
+                }
+
+                return S_OK;
+            };
+
+            std::unique_ptr<CompressedVertex[]> full(new CompressedVertex[nVerts]);
+            memset(full.get(), 0, sizeof(CompressedVertex) * nVerts);
+
+            hr = convert(full.get(), nVerts);
+            if (FAILED(hr))
+            {
+                success = false;
+                printe("ERROR: Failed VB whole-buffer conversion (%08X)\n", static_cast<unsigned int>(hr));
+            }
+            else
+            {
+                static const size_t s_chunks[] = { 1, 3, 64, 1000 };
+
+                std::unique_ptr<CompressedVertex[]> vb(new CompressedVertex[nVerts]);
+
+                for (size_t k = 0; k < std::size(s_chunks); ++k)
+                {
+                    memset(vb.get(), 0xCD, sizeof(CompressedVertex) * nVerts);
+
+                    hr = convert(vb.get(), s_chunks[k]);
+                    if (FAILED(hr))
+                    {
+                        success = false;
+                        printe("ERROR: Failed VB chunked conversion, chunk %zu (%08X)\n", s_chunks[k], static_cast<unsigned int>(hr));
+                    }
+                    else if (memcmp(vb.get(), full.get(), sizeof(CompressedVertex) * nVerts) != 0)
+                    {
+                        success = false;
+                        printe("ERROR: VB chunked conversion differs from whole-buffer conversion, chunk %zu\n", s_chunks[k]);
+                    }
+                }
+
+                // Disjoint ranges converted concurrently, each with its own reader and writer
+                constexpr size_t nThreads = 4;
+
+                memset(vb.get(), 0xCD, sizeof(CompressedVertex) * nVerts);
+
+                HRESULT results[nThreads] = {};
+
+                std::vector<std::thread> threads;
+                threads.reserve(nThreads);
+                for (size_t t = 0; t < nThreads; ++t)
+                {
+                    threads.emplace_back([&, t]()
+                    {
+                        const size_t first = nVerts * t / nThreads;
+                        const size_t count = nVerts * (t + 1) / nThreads - first;
+
+                        auto rangeReader = std::make_unique<VBReader>();
+                        auto rangeWriter = std::make_unique<VBWriter>();
+                        auto temp = make_AlignedArrayXMVECTOR(count);
+
+                        HRESULT result = rangeReader->Initialize(srcDesc);
+                        if (SUCCEEDED(result))
+                            result = rangeReader->AddStream(src.get() + first, count, 0, sizeof(VSStarterKitVertex1));
+                        if (SUCCEEDED(result))
+                            result = rangeWriter->Initialize(destDesc);
+                        if (SUCCEEDED(result))
+                            result = rangeWriter->AddStream(vb.get() + first, count, 0, sizeof(CompressedVertex));
+
+                        for (size_t j = 0; SUCCEEDED(result) && j < std::size(s_compressedIL); ++j)
+                        {
+                            const bool x2bias = (s_compressedIL[j].Format == DXGI_FORMAT_R10G10B10A2_UNORM);
+
+                            result = rangeReader->Read(temp.get(), s_compressedIL[j].SemanticName, s_compressedIL[j].SemanticIndex, count);
+                            if (SUCCEEDED(result))
+                                result = rangeWriter->Write(temp.get(), s_compressedIL[j].SemanticName, s_compressedIL[j].SemanticIndex, count, x2bias);
+                        }
+
+                        results[t] = result;
+                    });
+                }
+
+                for (auto& it : threads)
+                {
+                    it.join();
+                }
+
+                bool converted = true;
+                for (size_t t = 0; t < nThreads; ++t)
+                {
+                    if (FAILED(results[t]))
+                    {
+                        converted = false;
+                        success = false;
+                        printe("ERROR: Failed VB concurrent range conversion, range %zu (%08X)\n", t, static_cast<unsigned int>(results[t]));
+                    }
+                }
+
+                if (converted && memcmp(vb.get(), full.get(), sizeof(CompressedVertex) * nVerts) != 0)
+                {
+                    success = false;
+                    printe("ERROR: VB concurrent range conversion differs from whole-buffer conversion\n");
+                }
+            }
+        }
+    }
+
     print("%zu meshes tested, %zu meshes passed ", ncount, npass );
 
     return success;